@@ -10,7 +10,7 @@
 #include "Rive/RiveDescriptor.h"
 #include "Rive/RiveFile.h"
 #include "Rive/RiveTexture.h"
-#include "Stats/RiveStats.h"
+#include "RiveStats.h"
 
 class FRiveStateMachine;
 
@@ -151,14 +151,16 @@ void URiveActorComponent::TickComponent(
 
     if (RiveRenderTarget)
     {
+        bool bNeedsRedraw = false;
         for (URiveArtboard* Artboard : Artboards)
         {
             RiveRenderTarget->Save();
             Artboard->Tick(DeltaTime);
             RiveRenderTarget->Restore();
+            bNeedsRedraw |= Artboard->NeedsRedraw();
         }
 
-        RiveRenderTarget->SubmitAndClear();
+        RiveRenderTarget->SubmitAndClearIfChanged(bNeedsRedraw);
     }
 }
 
@@ -287,7 +289,9 @@ URiveArtboard* URiveActorComponent::AddArtboard(
         return nullptr;
     }
 
-    URiveArtboard* Artboard = NewObject<URiveArtboard>();
+    // Outered to this component so FRiveTickManager finds its world
+    URiveArtboard* Artboard = NewObject<URiveArtboard>(this);
+    Artboard->AssetLoadPriority = DefaultRiveDescriptor.AssetLoadPriority;
     Artboard->Initialize(InRiveFile,
                          RiveRenderTarget,
                          InArtboardName,
@@ -405,35 +409,22 @@ void URiveActorComponent::OnDefaultArtboardTickRender(float DeltaTime,
 
 TArray<FString> URiveActorComponent::GetArtboardNamesForDropdown() const
 {
-    TArray<FString> Output;
     if (DefaultRiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* Artboard :
-             DefaultRiveDescriptor.RiveFile->Artboards)
-        {
-            Output.Add(Artboard->GetArtboardName());
-        }
+        return DefaultRiveDescriptor.RiveFile->GetArtboardNamesForDropdown();
     }
-    return Output;
+    return {};
 }
 
 TArray<FString> URiveActorComponent::GetStateMachineNamesForDropdown() const
 {
-    TArray<FString> Output{""};
     if (DefaultRiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* Artboard :
-             DefaultRiveDescriptor.RiveFile->Artboards)
-        {
-            if (Artboard->GetArtboardName().Equals(
-                    DefaultRiveDescriptor.ArtboardName))
-            {
-                Output.Append(Artboard->GetStateMachineNames());
-                break;
-            }
-        }
+        const URiveFile* RiveFile = DefaultRiveDescriptor.RiveFile;
+        return RiveFile->GetStateMachineNamesForDropdown(
+            DefaultRiveDescriptor.ArtboardName);
     }
-    return Output;
+    return {""};
 }
 
 void URiveActorComponent::InitializeAudioEngine()
@@ -2,6 +2,9 @@
 
 #include "Rive/Assets/RiveAsset.h"
 
+#include "Rive/Assets/RiveAssetHelpers.h"
+#include "Rive/RiveCustomVersion.h"
+
 void URiveAsset::PostLoad()
 {
     UObject::PostLoad();
@@ -23,3 +26,29 @@ void URiveAsset::PostLoad()
             break;
     }
 }
+
+void URiveAsset::Serialize(FArchive& Ar)
+{
+    UObject::Serialize(Ar);
+
+    Ar.UsingCustomVersion(FRiveCustomVersion::GUID);
+    if (Ar.IsLoading() && Ar.CustomVer(FRiveCustomVersion::GUID) <
+                              FRiveCustomVersion::BulkDataPayloads)
+    {
+        SetNativeAssetBytes(NativeAssetBytes_DEPRECATED);
+        NativeAssetBytes_DEPRECATED.Empty();
+        return;
+    }
+
+    NativeAssetBulkData.Serialize(Ar, this);
+}
+
+void URiveAsset::GetNativeAssetBytes(TArray<uint8>& OutBytes)
+{
+    RiveAssetHelpers::ReadBulkData(NativeAssetBulkData, OutBytes);
+}
+
+void URiveAsset::SetNativeAssetBytes(const TArray<uint8>& InBytes)
+{
+    RiveAssetHelpers::SetBulkData(NativeAssetBulkData, InBytes);
+}
@@ -104,3 +104,27 @@ ERiveAssetType RiveAssetHelpers::GetUnrealType(uint16_t RiveType)
             return ERiveAssetType::None;
     }
 }
+
+void RiveAssetHelpers::SetBulkData(FByteBulkData& InOutBulkData,
+                                   const TArray<uint8>& InBytes)
+{
+    InOutBulkData.Lock(LOCK_READ_WRITE);
+    void* Data = InOutBulkData.Realloc(InBytes.Num());
+    FMemory::Memcpy(Data, InBytes.GetData(), InBytes.Num());
+    InOutBulkData.Unlock();
+    InOutBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+}
+
+void RiveAssetHelpers::ReadBulkData(FByteBulkData& InBulkData,
+                                    TArray<uint8>& OutBytes)
+{
+    OutBytes.SetNumUninitialized(
+        static_cast<int32>(InBulkData.GetBulkDataSize()));
+    if (OutBytes.IsEmpty())
+    {
+        return;
+    }
+
+    void* Data = OutBytes.GetData();
+    InBulkData.GetCopy(&Data, true);
+}
@@ -0,0 +1,171 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/Assets/RiveDecodedAssetCache.h"
+
+#include "Hash/xxhash.h"
+#include "RiveStats.h"
+
+#if WITH_RIVE
+THIRD_PARTY_INCLUDES_START
+#include "rive/factory.hpp"
+#include "rive/renderer.hpp"
+#include "rive/text_engine.hpp"
+THIRD_PARTY_INCLUDES_END
+#endif // WITH_RIVE
+
+FRiveDecodedAssetCache& FRiveDecodedAssetCache::Get()
+{
+    static FRiveDecodedAssetCache DecodedAssetCache;
+    return DecodedAssetCache;
+}
+
+void FRiveDecodedAssetCache::Shutdown()
+{
+#if WITH_RIVE
+    // The images hold RHI textures, release them before the RHI goes away
+    FScopeLock Lock(&AssetsCS);
+    Images.Empty();
+    Fonts.Empty();
+#endif // WITH_RIVE
+}
+
+#if WITH_RIVE
+
+uint64 FRiveDecodedAssetCache::HashBytes(rive::Span<const uint8> InBytes)
+{
+    return FXxHash64::HashBuffer(InBytes.data(), InBytes.size()).Hash;
+}
+
+void FRiveDecodedAssetCache::RecordHit(uint64 InBytesSaved)
+{
+    INC_DWORD_STAT(STAT_RiveAssetCacheHits);
+    INC_MEMORY_STAT_BY(STAT_RiveAssetCacheBytesSaved, InBytesSaved);
+}
+
+uint64 FRiveDecodedAssetCache::GetImageSizeInBytes(
+    const rive::RenderImage& InImage)
+{
+    return static_cast<uint64>(InImage.width()) * InImage.height() * 4;
+}
+
+rive::rcp<rive::RenderImage> FRiveDecodedAssetCache::FindImage(
+    uint64 InHash,
+    rive::Span<const uint8> InBytes)
+{
+    FScopeLock Lock(&AssetsCS);
+    return FindEntry(Images, InHash, InBytes);
+}
+
+rive::rcp<rive::RenderImage> FRiveDecodedAssetCache::AddImage(
+    uint64 InHash,
+    rive::Span<const uint8> InBytes,
+    rive::rcp<rive::RenderImage> InImage)
+{
+    FScopeLock Lock(&AssetsCS);
+    return AddEntry(Images, InHash, InBytes, MoveTemp(InImage));
+}
+
+rive::rcp<rive::RenderImage> FRiveDecodedAssetCache::FindOrDecodeImage(
+    rive::Span<const uint8> InBytes,
+    rive::Factory* InFactory)
+{
+    const uint64 Hash = HashBytes(InBytes);
+    if (rive::rcp<rive::RenderImage> Image = FindImage(Hash, InBytes))
+    {
+        RecordHit(GetImageSizeInBytes(*Image));
+        return Image;
+    }
+
+    rive::rcp<rive::RenderImage> Image = InFactory->decodeImage(InBytes);
+    return Image ? AddImage(Hash, InBytes, Image) : nullptr;
+}
+
+rive::rcp<rive::Font> FRiveDecodedAssetCache::FindOrDecodeFont(
+    rive::Span<const uint8> InBytes,
+    rive::Factory* InFactory)
+{
+    const uint64 Hash = HashBytes(InBytes);
+    {
+        FScopeLock Lock(&AssetsCS);
+        if (rive::rcp<rive::Font> Font = FindEntry(Fonts, Hash, InBytes))
+        {
+            // The decoded font keeps its own copy of the bytes
+            RecordHit(InBytes.size());
+            return Font;
+        }
+    }
+
+    // Decoded outside the lock, if another thread decoded the same font in
+    // the meantime theirs is kept
+    rive::rcp<rive::Font> Font = InFactory->decodeFont(InBytes);
+    if (!Font)
+    {
+        return nullptr;
+    }
+
+    FScopeLock Lock(&AssetsCS);
+    return AddEntry(Fonts, Hash, InBytes, MoveTemp(Font));
+}
+
+void FRiveDecodedAssetCache::RemoveUnused()
+{
+    FScopeLock Lock(&AssetsCS);
+    RemoveUnusedEntries(Images);
+    RemoveUnusedEntries(Fonts);
+}
+
+template <typename T>
+rive::rcp<T> FRiveDecodedAssetCache::FindEntry(
+    const TMap<uint64, TEntry<T>>& InEntries,
+    uint64 InHash,
+    rive::Span<const uint8> InBytes)
+{
+    const TEntry<T>* Entry = InEntries.Find(InHash);
+    if (Entry == nullptr ||
+        Entry->Bytes.Num() != static_cast<int32>(InBytes.size()) ||
+        FMemory::Memcmp(Entry->Bytes.GetData(),
+                        InBytes.data(),
+                        InBytes.size()) != 0)
+    {
+        return nullptr;
+    }
+    return Entry->Value;
+}
+
+template <typename T>
+rive::rcp<T> FRiveDecodedAssetCache::AddEntry(
+    TMap<uint64, TEntry<T>>& InOutEntries,
+    uint64 InHash,
+    rive::Span<const uint8> InBytes,
+    rive::rcp<T> InValue)
+{
+    if (InOutEntries.Contains(InHash))
+    {
+        rive::rcp<T> Value = FindEntry(InOutEntries, InHash, InBytes);
+        return Value ? Value : InValue;
+    }
+
+    INC_DWORD_STAT(STAT_RiveAssetCacheMisses);
+    RemoveUnusedEntries(InOutEntries);
+    InOutEntries.Add(
+        InHash,
+        {TArray<uint8>(InBytes.data(), static_cast<int32>(InBytes.size())),
+         InValue});
+    return InValue;
+}
+
+template <typename T>
+void FRiveDecodedAssetCache::RemoveUnusedEntries(
+    TMap<uint64, TEntry<T>>& InOutEntries)
+{
+    // An entry only referenced by the cache has no rive file left using it
+    for (auto It = InOutEntries.CreateIterator(); It; ++It)
+    {
+        if (It.Value().Value->debugging_refcnt() == 1)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+#endif // WITH_RIVE
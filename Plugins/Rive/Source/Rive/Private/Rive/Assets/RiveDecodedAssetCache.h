@@ -0,0 +1,112 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_RIVE
+THIRD_PARTY_INCLUDES_START
+#include "rive/refcnt.hpp"
+#include "rive/span.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace rive
+{
+class Factory;
+class Font;
+class RenderImage;
+} // namespace rive
+#endif // WITH_RIVE
+
+/**
+ * Images and fonts decoded for rive files, keyed by a hash of their encoded
+ * bytes, so an asset embedded in several files is decoded (and uploaded) once.
+ * Entries keep a copy of those bytes to tell hash collisions apart, and are
+ * dropped once nothing uses their image or font anymore.
+ */
+class FRiveDecodedAssetCache
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    static FRiveDecodedAssetCache& Get();
+
+    void Shutdown();
+
+#if WITH_RIVE
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    static uint64 HashBytes(rive::Span<const uint8> InBytes);
+
+    /** Updates the cache stats for an image or font that was not decoded */
+    static void RecordHit(uint64 InBytesSaved);
+
+    static uint64 GetImageSizeInBytes(const rive::RenderImage& InImage);
+
+    /** InHash must be HashBytes(InBytes) */
+    rive::rcp<rive::RenderImage> FindImage(uint64 InHash,
+                                           rive::Span<const uint8> InBytes);
+
+    /**
+     * Returns the image cached for InBytes, which is InImage unless another
+     * thread decoded the same bytes first
+     */
+    rive::rcp<rive::RenderImage> AddImage(uint64 InHash,
+                                          rive::Span<const uint8> InBytes,
+                                          rive::rcp<rive::RenderImage> InImage);
+
+    rive::rcp<rive::RenderImage> FindOrDecodeImage(
+        rive::Span<const uint8> InBytes,
+        rive::Factory* InFactory);
+
+    rive::rcp<rive::Font> FindOrDecodeFont(rive::Span<const uint8> InBytes,
+                                           rive::Factory* InFactory);
+
+    /** Drops the images and fonts no rive file uses anymore */
+    void RemoveUnused();
+
+private:
+    template <typename T> struct TEntry
+    {
+        TArray<uint8> Bytes;
+        rive::rcp<T> Value;
+    };
+
+    /** Called with AssetsCS held */
+    template <typename T>
+    static rive::rcp<T> FindEntry(const TMap<uint64, TEntry<T>>& InEntries,
+                                  uint64 InHash,
+                                  rive::Span<const uint8> InBytes);
+
+    /**
+     * Called with AssetsCS held. Bytes colliding with the hash of another
+     * entry are not cached, InValue is returned as is.
+     */
+    template <typename T>
+    static rive::rcp<T> AddEntry(TMap<uint64, TEntry<T>>& InOutEntries,
+                                 uint64 InHash,
+                                 rive::Span<const uint8> InBytes,
+                                 rive::rcp<T> InValue);
+
+    /** Called with AssetsCS held */
+    template <typename T>
+    static void RemoveUnusedEntries(TMap<uint64, TEntry<T>>& InOutEntries);
+
+    /**
+     * Attribute(s)
+     */
+
+    FCriticalSection AssetsCS;
+
+    TMap<uint64, TEntry<rive::RenderImage>> Images;
+
+    TMap<uint64, TEntry<rive::Font>> Fonts;
+
+#endif // WITH_RIVE
+};
@@ -131,8 +131,12 @@ bool FRiveFileAssetImporter::loadContents(rive::FileAsset& InAsset,
     FString AssetPath;
     if (RiveAssetHelpers::FindDiskAsset(RiveFilePath, RiveAsset))
     {
-        if (!FFileHelper::LoadFileToArray(RiveAsset->NativeAssetBytes,
-                                          *AssetPath))
+        TArray<uint8> AssetBytes;
+        if (FFileHelper::LoadFileToArray(AssetBytes, *AssetPath))
+        {
+            RiveAsset->SetNativeAssetBytes(AssetBytes);
+        }
+        else
         {
             UE_LOG(LogRive,
                    Error,
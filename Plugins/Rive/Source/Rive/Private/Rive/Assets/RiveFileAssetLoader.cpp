@@ -3,13 +3,17 @@
 #include "Rive/Assets/RiveFileAssetLoader.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
 #include "Engine/Engine.h"
+#include "IRiveRenderer.h"
 #include "Logs/RiveLog.h"
 #include "Rive/Assets/RiveAsset.h"
 #include "Rive/Assets/RiveAssetHelpers.h"
 #include "Rive/Assets/RiveAudioAsset.h"
+#include "Rive/Assets/RiveDecodedAssetCache.h"
 #include "Rive/Assets/RiveFontAsset.h"
 #include "Rive/Assets/RiveImageAsset.h"
+#include "RiveStats.h"
 #include "UObject/Package.h"
 #include "UObject/SavePackage.h"
 
@@ -19,6 +23,9 @@ THIRD_PARTY_INCLUDES_START
 #include "rive/assets/file_asset.hpp"
 #include "rive/assets/font_asset.hpp"
 #include "rive/assets/image_asset.hpp"
+#include "rive/renderer.hpp"
+#include "rive/renderer/render_context.hpp"
+#include "rive/text_engine.hpp"
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 
@@ -132,12 +139,46 @@ URiveAsset* ReplaceAsset(UObject* Outer, URiveAsset* RiveAsset)
 
 FRiveFileAssetLoader::FRiveFileAssetLoader(
     UObject* InOuter,
-    TMap<uint32, TObjectPtr<URiveAsset>>& InAssets) :
-    Outer(InOuter), Assets(InAssets)
+    TMap<uint32, TObjectPtr<URiveAsset>>& InAssets,
+    bool bInDeferObjectCreation) :
+    Outer(InOuter),
+    Assets(InAssets),
+    bDeferObjectCreation(bInDeferObjectCreation)
 {}
 
+void FRiveFileAssetLoader::ReplaceOutdatedAssets()
+{
+    check(IsInGameThread());
+
+    for (TPair<uint32, TObjectPtr<URiveAsset>>& Asset : Assets)
+    {
+        if (Asset.Value != nullptr &&
+            UE::Private::RiveFileAssetLoader::NeedsClassReplacement(
+                Asset.Value))
+        {
+            if (URiveAsset* NewAsset =
+                    UE::Private::RiveFileAssetLoader::ReplaceAsset(Outer,
+                                                                   Asset.Value))
+            {
+                Asset.Value = NewAsset;
+            }
+        }
+    }
+}
+
 #if WITH_RIVE
 
+void FRiveFileAssetLoader::CreateDeferredAssets()
+{
+    check(IsInGameThread());
+
+    for (rive::FileAsset* DeferredAsset : DeferredAssets)
+    {
+        CreateInBandAsset(*DeferredAsset)->NativeAsset = DeferredAsset;
+    }
+    DeferredAssets.Empty();
+}
+
 bool FRiveFileAssetLoader::loadContents(rive::FileAsset& InAsset,
                                         rive::Span<const uint8> InBandBytes,
                                         rive::Factory* InFactory)
@@ -163,7 +204,9 @@ bool FRiveFileAssetLoader::loadContents(rive::FileAsset& InAsset,
     {
         RiveAsset = RiveAssetPtr->Get();
 
-        if (UE::Private::RiveFileAssetLoader::NeedsClassReplacement(RiveAsset))
+        // Deferred loads had their assets replaced by ReplaceOutdatedAssets
+        if (!bDeferObjectCreation &&
+            UE::Private::RiveFileAssetLoader::NeedsClassReplacement(RiveAsset))
         {
             if (URiveAsset* NewAsset =
                     UE::Private::RiveFileAssetLoader::ReplaceAsset(Outer,
@@ -186,67 +229,57 @@ bool FRiveFileAssetLoader::loadContents(rive::FileAsset& InAsset,
             return false;
         }
 
-        ERiveAssetType Type =
-            RiveAssetHelpers::GetUnrealType(InAsset.coreType());
-        switch (Type)
+        if (bDeferObjectCreation)
         {
-            case ERiveAssetType::Audio:
-                RiveAsset = NewObject<URiveAudioAsset>(
-                    Outer,
-                    URiveAudioAsset::StaticClass(),
-                    MakeUniqueObjectName(
-                        Outer,
-                        URiveAudioAsset::StaticClass(),
-                        FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
-                    RF_Transient);
-                break;
-            case ERiveAssetType::Font:
-                RiveAsset = NewObject<URiveFontAsset>(
-                    Outer,
-                    URiveFontAsset::StaticClass(),
-                    MakeUniqueObjectName(
-                        Outer,
-                        URiveFontAsset::StaticClass(),
-                        FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
-                    RF_Transient);
-                break;
-            case ERiveAssetType::Image:
-                RiveAsset = NewObject<URiveImageAsset>(
-                    Outer,
-                    URiveImageAsset::StaticClass(),
-                    MakeUniqueObjectName(
-                        Outer,
-                        URiveImageAsset::StaticClass(),
-                        FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
-                    RF_Transient);
-                break;
-            default:
-                RiveAsset = NewObject<URiveAsset>(
-                    Outer,
-                    URiveAsset::StaticClass(),
-                    MakeUniqueObjectName(
-                        Outer,
-                        URiveAsset::StaticClass(),
-                        FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
-                    RF_Transient);
-                break;
-        }
+            if (InAsset.is<rive::ImageAsset>())
+            {
+                PendingImages.Add({InAsset.as<rive::ImageAsset>(),
+                                   KeepInBandImageBytes(InBandBytes)});
+                DeferredAssets.Add(&InAsset);
+                return true;
+            }
 
-        RiveAsset->Id = InAsset.assetId();
-        RiveAsset->Name = FString(UTF8_TO_TCHAR(InAsset.name().c_str()));
-        RiveAsset->Type = Type;
-        RiveAsset->bIsInBand = true;
+            if (InAsset.is<rive::FontAsset>())
+            {
+                rive::rcp<rive::Font> Font =
+                    FRiveDecodedAssetCache::Get().FindOrDecodeFont(InBandBytes,
+                                                                   InFactory);
+                if (Font == nullptr)
+                {
+                    UE_LOG(LogRive,
+                           Error,
+                           TEXT("Could not decode in band font: %s"),
+                           UTF8_TO_TCHAR(InAsset.name().c_str()));
+                    return false;
+                }
+                InAsset.as<rive::FontAsset>()->font(Font);
+                DeferredAssets.Add(&InAsset);
+                return true;
+            }
 
-        // We only add it to our assets here so that it shows up in the
-        // inspector, otherwise this doesn't have any functional effect on
-        // anything due to it being a transient, in-band asset
-        Assets.Add(InAsset.assetId(), RiveAsset);
+            // We may not be on the game thread, so let rive decode the asset
+            // and only wrap it in a URiveAsset in CreateDeferredAssets
+            rive::SimpleArray<uint8_t> Bytes(InBandBytes.data(),
+                                             InBandBytes.size());
+            if (!InAsset.decode(Bytes, InFactory))
+            {
+                UE_LOG(LogRive,
+                       Error,
+                       TEXT("Could not decode in band asset: %s"),
+                       UTF8_TO_TCHAR(InAsset.name().c_str()));
+                return false;
+            }
+            DeferredAssets.Add(&InAsset);
+            return true;
+        }
+
+        RiveAsset = CreateInBandAsset(InAsset);
     }
 
     rive::Span<const uint8> OutOfBandBytes;
     if (!bUseInBand)
     {
-        if (RiveAsset->NativeAssetBytes.IsEmpty())
+        if (!RiveAsset->HasNativeAssetBytes())
         {
             UE_LOG(LogRive,
                    Error,
@@ -254,12 +287,237 @@ bool FRiveFileAssetLoader::loadContents(rive::FileAsset& InAsset,
                         "never filled."));
             return false;
         }
-        OutOfBandBytes = rive::make_span(RiveAsset->NativeAssetBytes.GetData(),
-                                         RiveAsset->NativeAssetBytes.Num());
+
+        // Decoded once an artboard using it is initialized
+        if (bLoadOutOfBandAssetsOnDemand)
+        {
+            RiveAsset->NativeAsset = &InAsset;
+            RiveAsset->OnDemandLoadState = ERiveOnDemandLoadState::Pending;
+            return true;
+        }
+        TArray<uint8>& Bytes = OutOfBandAssetBytes.AddDefaulted_GetRef();
+        RiveAsset->GetNativeAssetBytes(Bytes);
+        OutOfBandBytes = rive::make_span(Bytes.GetData(), Bytes.Num());
         AssetBytes = &OutOfBandBytes;
     }
+    RiveAsset->OnDemandLoadState = ERiveOnDemandLoadState::None;
+
+    // Images are decoded together once the import is done
+    if (InAsset.is<rive::ImageAsset>())
+    {
+        PendingImages.Add({InAsset.as<rive::ImageAsset>(),
+                           bUseInBand ? KeepInBandImageBytes(InBandBytes)
+                                      : *AssetBytes});
+        RiveAsset->NativeAsset = &InAsset;
+        return true;
+    }
 
     return RiveAsset->LoadNativeAssetBytes(InAsset, InFactory, *AssetBytes);
 }
 
+rive::Span<const uint8> FRiveFileAssetLoader::KeepInBandImageBytes(
+    rive::Span<const uint8> InBytes)
+{
+    TArray<uint8>& Bytes = InBandImageBytes.Emplace_GetRef(
+        InBytes.data(),
+        static_cast<int32>(InBytes.size()));
+    return rive::make_span(Bytes.GetData(), Bytes.Num());
+}
+
+void FRiveFileAssetLoader::DecodePendingImages(IRiveRenderer* InRiveRenderer)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(
+        TEXT("FRiveFileAssetLoader::DecodePendingImages"),
+        STAT_FRiveFileAssetLoader_DecodePendingImages,
+        STATGROUP_Rive);
+
+    if (PendingImages.IsEmpty())
+    {
+        OutOfBandAssetBytes.Empty();
+        InBandImageBytes.Empty();
+        return;
+    }
+
+    struct FImageDecode
+    {
+        uint64 Hash;
+        rive::Span<const uint8> Bytes;
+        rive::rcp<rive::RenderImage> Image;
+        /** Whether Image was decoded by another file or is already used */
+        bool bReused;
+        /** Pixels to upload instead of decoding Bytes, for cooked files */
+        const FRiveCookedImage* CookedImage;
+    };
+
+    TMap<uint64, const FRiveCookedImage*> CookedImageByHash;
+    for (const FRiveCookedImage& CookedImage : CookedImages)
+    {
+        if (CookedImage.Offset >= 0 &&
+            CookedImage.Offset + CookedImage.GetSizeInBytes() <=
+                CookedImagePixels.Num())
+        {
+            CookedImageByHash.Add(CookedImage.Hash, &CookedImage);
+        }
+    }
+
+    // Identical bytes are only decoded once, and not at all if another file
+    // already decoded them
+    FRiveDecodedAssetCache& DecodedAssetCache = FRiveDecodedAssetCache::Get();
+    TArray<FImageDecode> Decodes;
+    TArray<int32> DecodeIndices;
+    TMap<uint64, int32> DecodeIndexByHash;
+    DecodeIndices.Reserve(PendingImages.Num());
+    for (const FPendingImage& PendingImage : PendingImages)
+    {
+        const uint64 Hash =
+            FRiveDecodedAssetCache::HashBytes(PendingImage.Bytes);
+        const int32* DecodeIndex = DecodeIndexByHash.Find(Hash);
+        if (DecodeIndex != nullptr &&
+            Decodes[*DecodeIndex].Bytes.size() == PendingImage.Bytes.size() &&
+            FMemory::Memcmp(Decodes[*DecodeIndex].Bytes.data(),
+                            PendingImage.Bytes.data(),
+                            PendingImage.Bytes.size()) == 0)
+        {
+            DecodeIndices.Add(*DecodeIndex);
+            continue;
+        }
+        rive::rcp<rive::RenderImage> CachedImage =
+            DecodedAssetCache.FindImage(Hash, PendingImage.Bytes);
+        const bool bCached = CachedImage != nullptr;
+        const int32 DecodeIndex =
+            Decodes.Add({Hash,
+                         PendingImage.Bytes,
+                         MoveTemp(CachedImage),
+                         bCached,
+                         CookedImageByHash.FindRef(Hash)});
+        DecodeIndexByHash.FindOrAdd(Hash, DecodeIndex);
+        DecodeIndices.Add(DecodeIndex);
+    }
+
+    {
+        // Workers use the factory under the lock held by this thread
+        FScopeLock Lock(&InRiveRenderer->GetThreadDataCS());
+        rive::Factory* Factory = InRiveRenderer->GetFactory();
+        ParallelFor(
+            Decodes.Num(),
+            [this, &Decodes, &DecodedAssetCache, InRiveRenderer, Factory](
+                int32 Index) {
+                FImageDecode& Decode = Decodes[Index];
+                if (Decode.Image == nullptr)
+                {
+                    if (rive::rcp<rive::RenderImage> Image =
+                            Decode.CookedImage != nullptr
+                                ? MakeCookedImage(InRiveRenderer,
+                                                  *Decode.CookedImage)
+                                : Factory->decodeImage(Decode.Bytes))
+                    {
+                        Decode.Image = DecodedAssetCache.AddImage(Decode.Hash,
+                                                                  Decode.Bytes,
+                                                                  Image);
+                    }
+                }
+            },
+            InRiveRenderer->SupportsParallelImageDecode()
+                ? EParallelForFlags::None
+                : EParallelForFlags::ForceSingleThread);
+    }
+
+    for (int32 Index = 0; Index < PendingImages.Num(); ++Index)
+    {
+        rive::ImageAsset* ImageAsset = PendingImages[Index].Asset;
+        FImageDecode& Decode = Decodes[DecodeIndices[Index]];
+        if (Decode.Image == nullptr)
+        {
+            UE_LOG(LogRive,
+                   Error,
+                   TEXT("Could not decode image asset: %s"),
+                   UTF8_TO_TCHAR(ImageAsset->name().c_str()));
+            continue;
+        }
+        if (Decode.bReused)
+        {
+            FRiveDecodedAssetCache::RecordHit(
+                FRiveDecodedAssetCache::GetImageSizeInBytes(*Decode.Image));
+        }
+        Decode.bReused = true;
+        ImageAsset->renderImage(Decode.Image);
+    }
+    PendingImages.Empty();
+    OutOfBandAssetBytes.Empty();
+    InBandImageBytes.Empty();
+}
+
+rive::rcp<rive::RenderImage> FRiveFileAssetLoader::MakeCookedImage(
+    IRiveRenderer* InRiveRenderer,
+    const FRiveCookedImage& InImage) const
+{
+    INC_DWORD_STAT(STAT_RiveCookedImagesUsed);
+    return InRiveRenderer->MakeImageFromPixels(
+        InImage.Width,
+        InImage.Height,
+        TArray<uint8>(CookedImagePixels.GetData() + InImage.Offset,
+                      static_cast<int32>(InImage.GetSizeInBytes())),
+        PF_B8G8R8A8);
+}
+
+URiveAsset* FRiveFileAssetLoader::CreateInBandAsset(rive::FileAsset& InAsset)
+{
+    URiveAsset* RiveAsset = nullptr;
+    ERiveAssetType Type = RiveAssetHelpers::GetUnrealType(InAsset.coreType());
+    switch (Type)
+    {
+        case ERiveAssetType::Audio:
+            RiveAsset = NewObject<URiveAudioAsset>(
+                Outer,
+                URiveAudioAsset::StaticClass(),
+                MakeUniqueObjectName(
+                    Outer,
+                    URiveAudioAsset::StaticClass(),
+                    FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
+                RF_Transient);
+            break;
+        case ERiveAssetType::Font:
+            RiveAsset = NewObject<URiveFontAsset>(
+                Outer,
+                URiveFontAsset::StaticClass(),
+                MakeUniqueObjectName(
+                    Outer,
+                    URiveFontAsset::StaticClass(),
+                    FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
+                RF_Transient);
+            break;
+        case ERiveAssetType::Image:
+            RiveAsset = NewObject<URiveImageAsset>(
+                Outer,
+                URiveImageAsset::StaticClass(),
+                MakeUniqueObjectName(
+                    Outer,
+                    URiveImageAsset::StaticClass(),
+                    FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
+                RF_Transient);
+            break;
+        default:
+            RiveAsset = NewObject<URiveAsset>(
+                Outer,
+                URiveAsset::StaticClass(),
+                MakeUniqueObjectName(
+                    Outer,
+                    URiveAsset::StaticClass(),
+                    FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
+                RF_Transient);
+            break;
+    }
+
+    RiveAsset->Id = InAsset.assetId();
+    RiveAsset->Name = FString(UTF8_TO_TCHAR(InAsset.name().c_str()));
+    RiveAsset->Type = Type;
+    RiveAsset->bIsInBand = true;
+
+    // We only add it to our assets here so that it shows up in the
+    // inspector, otherwise this doesn't have any functional effect on
+    // anything due to it being a transient, in-band asset
+    Assets.Add(InAsset.assetId(), RiveAsset);
+    return RiveAsset;
+}
+
 #endif // WITH_RIVE
@@ -0,0 +1,148 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/Assets/RiveFileCooker.h"
+
+#if WITH_EDITOR && WITH_RIVE
+
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Logs/RiveLog.h"
+#include "Modules/ModuleManager.h"
+#include "Rive/Assets/RiveAsset.h"
+#include "Rive/Assets/RiveDecodedAssetCache.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/assets/image_asset.hpp"
+#include "rive/file.hpp"
+#include "rive/file_asset_loader.hpp"
+#include "utils/no_op_factory.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace UE::Private::RiveFileCooker
+{
+/** Collects the encoded images of a file instead of decoding them */
+class FImageCollector final : public rive::FileAssetLoader
+{
+public:
+    explicit FImageCollector(
+        const TMap<uint32, TObjectPtr<URiveAsset>>& InAssets) :
+        Assets(InAssets)
+    {}
+
+    virtual bool loadContents(rive::FileAsset& InAsset,
+                              rive::Span<const uint8> InBandBytes,
+                              rive::Factory* InFactory) override
+    {
+        if (!InAsset.is<rive::ImageAsset>())
+        {
+            return true;
+        }
+
+        // Same bytes FRiveFileAssetLoader::loadContents uses at runtime
+        TArray<uint8>& Bytes = Images.AddDefaulted_GetRef();
+        if (InBandBytes.size() > 0)
+        {
+            Bytes.Append(InBandBytes.data(), InBandBytes.size());
+        }
+        else if (const TObjectPtr<URiveAsset>* RiveAsset =
+                     Assets.Find(InAsset.assetId()))
+        {
+            if (*RiveAsset != nullptr)
+            {
+                (*RiveAsset)->GetNativeAssetBytes(Bytes);
+            }
+        }
+        return true;
+    }
+
+    TArray<TArray<uint8>> Images;
+
+private:
+    const TMap<uint32, TObjectPtr<URiveAsset>>& Assets;
+};
+} // namespace UE::Private::RiveFileCooker
+
+bool FRiveFileCooker::CookImages(
+    const FString& InFileName,
+    TArrayView<const uint8> InFileBytes,
+    const TMap<uint32, TObjectPtr<URiveAsset>>& InAssets,
+    TArray<FRiveCookedImage>& OutImages,
+    TArray<uint8>& OutPixels)
+{
+    OutImages.Reset();
+    OutPixels.Reset();
+
+    UE::Private::RiveFileCooker::FImageCollector ImageCollector(InAssets);
+    rive::NoOpFactory Factory;
+    rive::ImportResult ImportResult;
+    const std::unique_ptr<rive::File> NativeFile = rive::File::import(
+        rive::make_span(InFileBytes.GetData(), InFileBytes.Num()),
+        &Factory,
+        &ImportResult,
+        &ImageCollector);
+    if (ImportResult != rive::ImportResult::success)
+    {
+        return false;
+    }
+
+    IImageWrapperModule& ImageWrapperModule =
+        FModuleManager::LoadModuleChecked<IImageWrapperModule>(
+            FName("ImageWrapper"));
+    for (const TArray<uint8>& Bytes : ImageCollector.Images)
+    {
+        if (Bytes.IsEmpty())
+        {
+            continue;
+        }
+
+        const uint64 Hash = FRiveDecodedAssetCache::HashBytes(
+            rive::make_span(Bytes.GetData(), Bytes.Num()));
+        if (OutImages.ContainsByPredicate(
+                [Hash](const FRiveCookedImage& Image) {
+                    return Image.Hash == Hash;
+                }))
+        {
+            continue;
+        }
+
+        // The renderer decodes other formats with rive's own decoders
+        const EImageFormat Format =
+            ImageWrapperModule.DetectImageFormat(Bytes.GetData(), Bytes.Num());
+        if (Format != EImageFormat::PNG && Format != EImageFormat::JPEG)
+        {
+            continue;
+        }
+
+        TArray<uint8> Pixels;
+        TSharedPtr<IImageWrapper> ImageWrapper =
+            ImageWrapperModule.CreateImageWrapper(Format);
+        if (!ImageWrapper.IsValid() ||
+            !ImageWrapper->SetCompressed(Bytes.GetData(), Bytes.Num()) ||
+            !ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, Pixels))
+        {
+            UE_LOG(LogRive,
+                   Warning,
+                   TEXT("Could not decode an image of rive file '%s' while "
+                        "cooking, it will be decoded at runtime."),
+                   *InFileName);
+            continue;
+        }
+
+        FRiveCookedImage& Image = OutImages.AddDefaulted_GetRef();
+        Image.Hash = Hash;
+        Image.Width = ImageWrapper->GetWidth();
+        Image.Height = ImageWrapper->GetHeight();
+        Image.Offset = OutPixels.Num();
+        OutPixels.Append(Pixels);
+    }
+
+    UE_LOG(LogRive,
+           Verbose,
+           TEXT("Cooked %d image(s) of rive file '%s' (%d bytes)"),
+           OutImages.Num(),
+           *InFileName,
+           OutPixels.Num());
+    return true;
+}
+
+#endif // WITH_EDITOR && WITH_RIVE
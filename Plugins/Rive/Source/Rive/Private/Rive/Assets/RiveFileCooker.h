@@ -0,0 +1,36 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Rive/Assets/RiveCookedImage.h"
+
+class URiveAsset;
+
+/**
+ * Pre-processes a rive file while it is cooked, so loading the cooked file
+ * skips work that does not depend on the running game
+ */
+class FRiveFileCooker
+{
+#if WITH_EDITOR && WITH_RIVE
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /**
+     * Imports InFileBytes without a renderer to make sure the file loads, then
+     * decodes its in band and out of band PNG and JPEG images to 8 bit BGRA.
+     * Returns false if the file does not import. Images the image wrapper
+     * can't read are left to be decoded at runtime.
+     */
+    static bool CookImages(const FString& InFileName,
+                           TArrayView<const uint8> InFileBytes,
+                           const TMap<uint32, TObjectPtr<URiveAsset>>& InAssets,
+                           TArray<FRiveCookedImage>& OutImages,
+                           TArray<uint8>& OutPixels);
+
+#endif // WITH_EDITOR && WITH_RIVE
+};
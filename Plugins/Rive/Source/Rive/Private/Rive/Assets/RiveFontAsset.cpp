@@ -6,6 +6,7 @@
 #include "IRiveRendererModule.h"
 #include "Engine/FontFace.h"
 #include "Logs/RiveLog.h"
+#include "Rive/Assets/RiveDecodedAssetCache.h"
 
 THIRD_PARTY_INCLUDES_START
 #include "rive/renderer/render_context.hpp"
@@ -53,16 +54,18 @@ void URiveFontAsset::LoadFontBytes(const TArray<uint8>& InBytes)
     RiveRenderer->CallOrRegister_OnInitialized(
         IRiveRenderer::FOnRendererInitialized::FDelegate::CreateLambda(
             [this, InBytes](IRiveRenderer* RiveRenderer) {
-                rive::gpu::RenderContext* RenderContext;
+                rive::Factory* Factory;
                 {
                     FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-                    RenderContext = RiveRenderer->GetRenderContext();
+                    Factory = RiveRenderer->GetFactory();
                 }
 
-                if (ensure(RenderContext))
+                if (ensure(Factory))
                 {
-                    auto DecodedFont = RenderContext->decodeFont(
-                        rive::make_span(InBytes.GetData(), InBytes.Num()));
+                    auto DecodedFont =
+                        FRiveDecodedAssetCache::Get().FindOrDecodeFont(
+                            rive::make_span(InBytes.GetData(), InBytes.Num()),
+                            Factory);
 
                     if (DecodedFont == nullptr)
                     {
@@ -85,7 +88,9 @@ bool URiveFontAsset::LoadNativeAssetBytes(
     rive::Factory* InRiveFactory,
     const rive::Span<const uint8>& AssetBytes)
 {
-    rive::rcp<rive::Font> DecodedFont = InRiveFactory->decodeFont(AssetBytes);
+    rive::rcp<rive::Font> DecodedFont =
+        FRiveDecodedAssetCache::Get().FindOrDecodeFont(AssetBytes,
+                                                       InRiveFactory);
 
     if (DecodedFont == nullptr)
     {
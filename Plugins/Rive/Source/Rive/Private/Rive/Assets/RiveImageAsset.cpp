@@ -2,11 +2,10 @@
 
 #include "Rive/Assets/RiveImageAsset.h"
 
-#include "IImageWrapper.h"
-#include "IImageWrapperModule.h"
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
+#include "Rive/Assets/RiveDecodedAssetCache.h"
 
 #include "Engine/Texture2D.h"
 #include "Engine/Texture.h"
@@ -21,7 +20,9 @@ THIRD_PARTY_INCLUDES_END
 
 namespace UE::Private::RiveImageAsset
 {
-void GetTextureData(UTexture2D* Texture, TArray<uint8>& OutData)
+void GetTextureData(UTexture2D* Texture,
+                    TArray<uint8>& OutData,
+                    FIntPoint& OutSize)
 {
     if (!Texture)
     {
@@ -37,30 +38,57 @@ void GetTextureData(UTexture2D* Texture, TArray<uint8>& OutData)
         return;
     }
 
-    if (PlatformData->Mips.Num() > 1)
+    // Use the largest mip that has its data loaded, rive generates the
+    // smaller ones itself
+    FTexture2DMipMap* Mip = nullptr;
+    for (FTexture2DMipMap& PlatformMip : PlatformData->Mips)
     {
-        UE_LOG(LogTemp,
-               Warning,
-               TEXT("Can't load a texture with Mip count > 1"));
+        if (PlatformMip.BulkData.GetBulkDataSize() > 0)
+        {
+            Mip = &PlatformMip;
+            break;
+        }
+    }
+    if (!Mip)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No texture data available."));
         return;
     }
 
-    // Get the mip data from the first mip level
-    FTexture2DMipMap& Mip = PlatformData->Mips[0];
     if (const uint8* MipData =
-            static_cast<uint8*>(Mip.BulkData.Lock(LOCK_READ_ONLY)))
+            static_cast<uint8*>(Mip->BulkData.Lock(LOCK_READ_ONLY)))
     {
         // Copy data to output array
-        const uint32 MipSize = Mip.SizeX * Mip.SizeY * sizeof(FColor);
+        const uint32 MipSize = Mip->SizeX * Mip->SizeY * sizeof(FColor);
         OutData.SetNumUninitialized(MipSize);
         FMemory::Memcpy(OutData.GetData(), MipData, MipSize);
+        OutSize = FIntPoint(Mip->SizeX, Mip->SizeY);
     }
     else
     {
         UE_LOG(LogTemp, Warning, TEXT("No texture data available."));
     }
 
-    Mip.BulkData.Unlock();
+    Mip->BulkData.Unlock();
+}
+
+bool CanShareTexture(UTexture2D* Texture)
+{
+    // rive samples images as they are stored, sRGB textures would be
+    // converted to linear
+    if (Texture->SRGB || Texture->IsCurrentlyVirtualTextured())
+    {
+        return false;
+    }
+
+    // Don't keep a partially streamed in texture around
+    if (Texture->GetNumResidentMips() < Texture->GetNumMips())
+    {
+        return false;
+    }
+
+    const FTextureResource* Resource = Texture->GetResource();
+    return Resource && Resource->GetTextureRHI();
 }
 } // namespace UE::Private::RiveImageAsset
 
@@ -71,20 +99,13 @@ void URiveImageAsset::LoadTexture(UTexture2D* InTexture)
     if (!InTexture)
         return;
 
-    { // Ensure we have a single mip
-        int32 MipCount = InTexture->GetNumMips();
-        if (MipCount != 1)
-        {
-            UE_LOG(LogRive,
-                   Error,
-                   TEXT("LoadTexture: Texture being loaded needs to have 1 mip "
-                        "level to load. You "
-                        "can do this by either setting 'Mip Gen Settings' to "
-                        "'NoMipMaps', or 'Mip "
-                        "Gen Settings' to 'FromTextureGroup' AND 'Texture "
-                        "Group' set to 'UI'"));
-            return;
-        }
+    // Renderers that can't sample RHI textures go through the pixels
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    if (RiveRenderer && RiveRenderer->SupportsTextureImages() &&
+        UE::Private::RiveImageAsset::CanShareTexture(InTexture))
+    {
+        LoadTextureRHI(InTexture->GetResource()->GetTextureRHI());
+        return;
     }
 
     { // Ensure our compression is simple RGBA
@@ -95,56 +116,97 @@ void URiveImageAsset::LoadTexture(UTexture2D* InTexture)
                    Error,
                    TEXT("LoadTexture: Texture needs to be set to have a "
                         "'CompressionSetting' of "
-                        "'UserInterface2D'"));
+                        "'UserInterface2D', or not be sRGB"));
             return;
         }
     }
 
+    TArray<uint8> ImageData;
+    FIntPoint ImageSize;
+    UE::Private::RiveImageAsset::GetTextureData(InTexture,
+                                                ImageData,
+                                                ImageSize);
+
+    if (ImageData.IsEmpty())
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("LoadTexture: Could not get raw bitmap data from "
+                    "Texture."));
+        return;
+    }
+
+    LoadImagePixels(ImageData, ImageSize.X, ImageSize.Y, true);
+}
+
+void URiveImageAsset::LoadImagePixels(const TArray<uint8>& InPixels,
+                                      int32 InWidth,
+                                      int32 InHeight,
+                                      bool bInIsBGRA)
+{
+    if (InWidth <= 0 || InHeight <= 0 ||
+        InPixels.Num() != static_cast<int64>(InWidth) * InHeight * 4)
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("LoadImagePixels: Expected %d x %d x 4 bytes, got %d"),
+               InWidth,
+               InHeight,
+               InPixels.Num());
+        return;
+    }
+
     IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
 
     RiveRenderer->CallOrRegister_OnInitialized(
         IRiveRenderer::FOnRendererInitialized::FDelegate::CreateLambda(
-            [this, InTexture](IRiveRenderer* RiveRenderer) {
-                rive::gpu::RenderContext* RenderContext;
+            [this, InPixels, InWidth, InHeight, bInIsBGRA](
+                IRiveRenderer* RiveRenderer) {
+                rive::rcp<rive::RenderImage> RenderImage;
                 {
                     FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-                    RenderContext = RiveRenderer->GetRenderContext();
+                    RenderImage = RiveRenderer->MakeImageFromPixels(
+                        InWidth,
+                        InHeight,
+                        InPixels,
+                        bInIsBGRA ? PF_B8G8R8A8 : PF_R8G8B8A8);
                 }
 
-                if (ensure(RenderContext))
+                if (RenderImage == nullptr)
                 {
-                    TArray<uint8> ImageData;
-                    UE::Private::RiveImageAsset::GetTextureData(InTexture,
-                                                                ImageData);
+                    UE_LOG(LogRive,
+                           Error,
+                           TEXT("LoadImagePixels: Could not create image"));
+                    return;
+                }
 
-                    if (ImageData.IsEmpty())
-                    {
-                        UE_LOG(LogRive,
-                               Error,
-                               TEXT("LoadTexture: Could not get raw bitmap "
-                                    "data from Texture."));
-                        return;
-                    }
+                NativeAsset->as<rive::ImageAsset>()->renderImage(RenderImage);
+            }));
+}
+
+void URiveImageAsset::LoadTextureRHI(const FTextureRHIRef& InTexture)
+{
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+
+    RiveRenderer->CallOrRegister_OnInitialized(
+        IRiveRenderer::FOnRendererInitialized::FDelegate::CreateLambda(
+            [this, InTexture](IRiveRenderer* RiveRenderer) {
+                rive::rcp<rive::RenderImage> RenderImage;
+                {
+                    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+                    RenderImage = RiveRenderer->MakeImageFromTexture(InTexture);
+                }
 
-                    TArray64<uint8> CompressedImage;
-                    FImageView ImageView = FImageView(ImageData.GetData(),
-                                                      InTexture->GetSizeX(),
-                                                      InTexture->GetSizeY(),
-                                                      ERawImageFormat::BGRA8);
-                    IImageWrapperModule& ImageWrapperModule =
-                        FModuleManager::LoadModuleChecked<IImageWrapperModule>(
-                            FName("ImageWrapper"));
-                    ImageWrapperModule.CompressImage(CompressedImage,
-                                                     EImageFormat::PNG,
-                                                     ImageView,
-                                                     100);
-                    rive::rcp<rive::RenderImage> RenderImage =
-                        RenderContext->decodeImage(
-                            rive::make_span(CompressedImage.GetData(),
-                                            CompressedImage.Num()));
-                    NativeAsset->as<rive::ImageAsset>()->renderImage(
-                        RenderImage);
+                if (RenderImage == nullptr)
+                {
+                    UE_LOG(LogRive,
+                           Error,
+                           TEXT("LoadTextureRHI: This renderer can't draw "
+                                "RHI textures"));
+                    return;
                 }
+
+                NativeAsset->as<rive::ImageAsset>()->renderImage(RenderImage);
             }));
 }
 
@@ -157,16 +219,18 @@ void URiveImageAsset::LoadImageBytes(const TArray<uint8>& InBytes)
     RiveRenderer->CallOrRegister_OnInitialized(
         IRiveRenderer::FOnRendererInitialized::FDelegate::CreateLambda(
             [this, InBytes](IRiveRenderer* RiveRenderer) {
-                rive::gpu::RenderContext* RenderContext;
+                rive::Factory* Factory;
                 {
                     FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-                    RenderContext = RiveRenderer->GetRenderContext();
+                    Factory = RiveRenderer->GetFactory();
                 }
 
-                if (ensure(RenderContext))
+                if (ensure(Factory))
                 {
-                    auto DecodedImage = RenderContext->decodeImage(
-                        rive::make_span(InBytes.GetData(), InBytes.Num()));
+                    auto DecodedImage =
+                        FRiveDecodedAssetCache::Get().FindOrDecodeImage(
+                            rive::make_span(InBytes.GetData(), InBytes.Num()),
+                            Factory);
 
                     if (DecodedImage == nullptr)
                     {
@@ -190,7 +254,8 @@ bool URiveImageAsset::LoadNativeAssetBytes(
     const rive::Span<const uint8>& AssetBytes)
 {
     rive::rcp<rive::RenderImage> DecodedImage =
-        InRiveFactory->decodeImage(AssetBytes);
+        FRiveDecodedAssetCache::Get().FindOrDecodeImage(AssetBytes,
+                                                        InRiveFactory);
 
     if (DecodedImage == nullptr)
     {
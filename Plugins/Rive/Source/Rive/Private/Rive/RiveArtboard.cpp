@@ -4,12 +4,15 @@
 
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
+#include "RiveScopeLock.h"
 #include "Logs/RiveLog.h"
 #include "Rive/RiveEvent.h"
 #include "Rive/RiveFile.h"
 #include "Rive/RiveStateMachine.h"
+#include "Rive/RiveTickManager.h"
 #include "Rive/ViewModel/RiveViewModelInstance.h"
-#include "Stats/RiveStats.h"
+#include "RiveStats.h"
+#include "RiveTrace.h"
 
 #if WITH_RIVE
 THIRD_PARTY_INCLUDES_START
@@ -35,6 +38,8 @@ void URiveArtboard::AdvanceStateMachine(float InDeltaSeconds)
     if (!RiveRenderTarget)
         return;
 
+    RIVE_TRACE_SCOPE_TEXT(TraceName);
+
     FRiveStateMachine* StateMachine = GetStateMachine();
     if (StateMachine && StateMachine->IsValid())
     {
@@ -44,14 +49,40 @@ void URiveArtboard::AdvanceStateMachine(float InDeltaSeconds)
             {
                 PopulateReportedEvents();
             }
-            StateMachine->Advance(InDeltaSeconds);
+            Advance_Internal(*StateMachine, InDeltaSeconds);
+        }
+        else
+        {
+            bNeedsRedraw = true;
         }
     }
+    else
+    {
+        FRiveScopeLock Lock(&ArtboardCS.Get());
+        bNeedsRedraw = bHasPendingChanges;
+        bHasPendingChanges = false;
+    }
 
     if (CurrentViewModelInstance.IsValid())
         CurrentViewModelInstance->HandleCallbacks();
 }
 
+void URiveArtboard::Advance_Internal(FRiveStateMachine& InStateMachine,
+                                     float InDeltaSeconds)
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    InStateMachine.Advance(InDeltaSeconds);
+    bNeedsRedraw = bHasPendingChanges || !InStateMachine.IsSettled();
+    bHasPendingChanges = false;
+}
+
+bool URiveArtboard::NeedsRedraw() const
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    return bNeedsRedraw || bIsReceivingInput ||
+           OnArtboardTick_StateMachine.IsBound();
+}
+
 void URiveArtboard::Transform(const FVector2f& One,
                               const FVector2f& Two,
                               const FVector2f& T)
@@ -120,74 +151,64 @@ void URiveArtboard::Draw()
         return;
     }
 
-    RiveRenderTarget->Draw(GetNativeArtboard());
+    RIVE_TRACE_SCOPE_TEXT(TraceName);
+    RiveRenderTarget->Draw(GetNativeArtboard(), ArtboardCS);
     LastDrawTransform = GetTransformMatrix();
 }
 
 void URiveArtboard::FireTrigger(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            StateMachine->FireTrigger(InPropertyName);
-        }
+        StateMachine->FireTrigger(InPropertyName);
     }
 }
 
 void URiveArtboard::FireTriggerAtPath(const FString& InInputName,
                                       const FString& InPath) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            return;
-        }
-
-        rive::SMITrigger* SmiTrigger =
-            NativeArtboardPtr->getTrigger(TCHAR_TO_UTF8(*InInputName),
-                                          TCHAR_TO_UTF8(*InPath));
-        if (!SmiTrigger)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            return;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        return;
+    }
 
-        if (!SmiTrigger->input()->is<rive::StateMachineTriggerBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a trigger"),
-                   *InInputName,
-                   *InPath);
-            return;
-        }
+    rive::SMITrigger* SmiTrigger =
+        NativeArtboardPtr->getTrigger(TCHAR_TO_UTF8(*InInputName),
+                                      TCHAR_TO_UTF8(*InPath));
+    if (!SmiTrigger)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        return;
+    }
 
-        SmiTrigger->fire();
+    if (!SmiTrigger->input()->is<rive::StateMachineTriggerBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a trigger"),
+               *InInputName,
+               *InPath);
+        return;
     }
+
+    SmiTrigger->fire();
+    bHasPendingChanges = true;
 }
 
 bool URiveArtboard::GetBoolValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            return StateMachine->GetBoolValue(InPropertyName);
-        }
+        return StateMachine->GetBoolValue(InPropertyName);
     }
     return false;
 }
@@ -196,60 +217,49 @@ bool URiveArtboard::GetBoolValueAtPath(const FString& InInputName,
                                        const FString& InPath,
                                        bool& OutSuccess) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return false;
-        }
-        rive::SMIBool* SmiBool =
-            NativeArtboardPtr->getBool(TCHAR_TO_UTF8(*InInputName),
-                                       TCHAR_TO_UTF8(*InPath));
-        if (!SmiBool)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return false;
-        }
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
-        if (!SmiBool->input()->is<rive::StateMachineBoolBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a bool"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return false;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return false;
+    }
+    rive::SMIBool* SmiBool =
+        NativeArtboardPtr->getBool(TCHAR_TO_UTF8(*InInputName),
+                                   TCHAR_TO_UTF8(*InPath));
+    if (!SmiBool)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return false;
+    }
 
-        OutSuccess = true;
-        return SmiBool->value();
+    if (!SmiBool->input()->is<rive::StateMachineBoolBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a bool"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return false;
     }
 
-    OutSuccess = false;
-    return false;
+    OutSuccess = true;
+    return SmiBool->value();
 }
 
 float URiveArtboard::GetNumberValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            return StateMachine->GetNumberValue(InPropertyName);
-        }
+        return StateMachine->GetNumberValue(InPropertyName);
     }
     return 0.f;
 }
@@ -258,65 +268,54 @@ float URiveArtboard::GetNumberValueAtPath(const FString& InInputName,
                                           const FString& InPath,
                                           bool& OutSuccess) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return 0.f;
-        }
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
-        rive::SMINumber* SmiNumber =
-            NativeArtboardPtr->getNumber(TCHAR_TO_UTF8(*InInputName),
-                                         TCHAR_TO_UTF8(*InPath));
-        if (!SmiNumber)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return 0.f;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return 0.f;
+    }
 
-        if (!SmiNumber->input()->is<rive::StateMachineNumberBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a number"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return 0.f;
-        }
+    rive::SMINumber* SmiNumber =
+        NativeArtboardPtr->getNumber(TCHAR_TO_UTF8(*InInputName),
+                                     TCHAR_TO_UTF8(*InPath));
+    if (!SmiNumber)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return 0.f;
+    }
 
-        OutSuccess = true;
-        return SmiNumber->value();
+    if (!SmiNumber->input()->is<rive::StateMachineNumberBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a number"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return 0.f;
     }
 
-    OutSuccess = false;
-    return 0.f;
+    OutSuccess = true;
+    return SmiNumber->value();
 }
 
 FString URiveArtboard::GetTextValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
+        if (const rive::TextValueRunBase* TextValueRun =
+                NativeArtboardPtr->find<rive::TextValueRunBase>(
+                    TCHAR_TO_UTF8(*InPropertyName)))
         {
-            if (const rive::TextValueRunBase* TextValueRun =
-                    NativeArtboardPtr->find<rive::TextValueRunBase>(
-                        TCHAR_TO_UTF8(*InPropertyName)))
-            {
-                return FString{TextValueRun->text().c_str()};
-            }
+            return FString{TextValueRun->text().c_str()};
         }
     }
     return {};
@@ -326,50 +325,39 @@ FString URiveArtboard::GetTextValueAtPath(const FString& InInputName,
                                           const FString& InPath,
                                           bool& OutSuccess) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return {};
-        }
-
-        rive::TextValueRunBase* TextValueRun =
-            NativeArtboardPtr->getTextRun(TCHAR_TO_UTF8(*InInputName),
-                                          TCHAR_TO_UTF8(*InPath));
-        if (!TextValueRun)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return {};
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return {};
+    }
 
-        OutSuccess = true;
-        return {TextValueRun->text().c_str()};
+    rive::TextValueRunBase* TextValueRun =
+        NativeArtboardPtr->getTextRun(TCHAR_TO_UTF8(*InInputName),
+                                      TCHAR_TO_UTF8(*InPath));
+    if (!TextValueRun)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return {};
     }
 
-    OutSuccess = false;
-    return {};
+    OutSuccess = true;
+    return {TextValueRun->text().c_str()};
 }
 
 void URiveArtboard::SetBoolValue(const FString& InPropertyName, bool bNewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            StateMachine->SetBoolValue(InPropertyName, bNewValue);
-        }
+        StateMachine->SetBoolValue(InPropertyName, bNewValue);
     }
 }
 
@@ -378,61 +366,52 @@ void URiveArtboard::SetBoolValueAtPath(const FString& InInputName,
                                        const FString& InPath,
                                        bool& OutSuccess)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return;
-        }
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
-        rive::SMIBool* SmiBool =
-            NativeArtboardPtr->getBool(TCHAR_TO_UTF8(*InInputName),
-                                       TCHAR_TO_UTF8(*InPath));
-        if (!SmiBool)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return;
+    }
 
-        if (!SmiBool->input()->is<rive::StateMachineBoolBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a bool"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
-        }
+    rive::SMIBool* SmiBool =
+        NativeArtboardPtr->getBool(TCHAR_TO_UTF8(*InInputName),
+                                   TCHAR_TO_UTF8(*InPath));
+    if (!SmiBool)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
+    }
 
-        SmiBool->value(InValue);
-        OutSuccess = true;
+    if (!SmiBool->input()->is<rive::StateMachineBoolBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a bool"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
     }
 
-    OutSuccess = false;
+    SmiBool->value(InValue);
+    bHasPendingChanges = true;
+    OutSuccess = true;
 }
 
 void URiveArtboard::SetNumberValue(const FString& InPropertyName,
                                    float NewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            StateMachine->SetNumberValue(InPropertyName, NewValue);
-        }
+        StateMachine->SetNumberValue(InPropertyName, NewValue);
     }
 }
 
@@ -441,65 +420,57 @@ void URiveArtboard::SetNumberValueAtPath(const FString& InInputName,
                                          const FString& InPath,
                                          bool& OutSuccess)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return;
-        }
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
-        rive::SMINumber* SmiNumber =
-            NativeArtboardPtr->getNumber(TCHAR_TO_UTF8(*InInputName),
-                                         TCHAR_TO_UTF8(*InPath));
-        if (!SmiNumber)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return;
+    }
 
-        if (!SmiNumber->input()->is<rive::StateMachineNumberBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a number"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
-        }
+    rive::SMINumber* SmiNumber =
+        NativeArtboardPtr->getNumber(TCHAR_TO_UTF8(*InInputName),
+                                     TCHAR_TO_UTF8(*InPath));
+    if (!SmiNumber)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
+    }
 
-        SmiNumber->value(InValue);
-        OutSuccess = true;
+    if (!SmiNumber->input()->is<rive::StateMachineNumberBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a number"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
     }
 
-    OutSuccess = false;
+    SmiNumber->value(InValue);
+    bHasPendingChanges = true;
+    OutSuccess = true;
 }
 
 void URiveArtboard::SetTextValue(const FString& InPropertyName,
                                  const FString& NewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
+        if (rive::TextValueRunBase* TextValueRun =
+                NativeArtboardPtr->find<rive::TextValueRunBase>(
+                    TCHAR_TO_UTF8(*InPropertyName)))
         {
-            if (rive::TextValueRunBase* TextValueRun =
-                    NativeArtboardPtr->find<rive::TextValueRunBase>(
-                        TCHAR_TO_UTF8(*InPropertyName)))
-            {
-                TextValueRun->text(TCHAR_TO_UTF8(*NewValue));
-            }
+            TextValueRun->text(TCHAR_TO_UTF8(*NewValue));
+            bHasPendingChanges = true;
         }
     }
 }
@@ -509,37 +480,326 @@ void URiveArtboard::SetTextValueAtPath(const FString& InInputName,
                                        const FString& InPath,
                                        bool& OutSuccess)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+
+    if (!NativeArtboardPtr)
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return;
+    }
+
+    rive::TextValueRunBase* TextValueRun =
+        NativeArtboardPtr->getTextRun(TCHAR_TO_UTF8(*InInputName),
+                                      TCHAR_TO_UTF8(*InPath));
+    if (!TextValueRun)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
+    }
+
+    TextValueRun->text(TCHAR_TO_UTF8(*InValue));
+    bHasPendingChanges = true;
+    OutSuccess = true;
+}
+
+FRiveInputHandle URiveArtboard::GetInputHandle(
+    const FString& InInputName) const
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+
+    const FRiveStateMachine* StateMachine = GetStateMachine();
+    if (!StateMachine || !StateMachine->IsValid())
+    {
+        return {};
+    }
+
+    const FTCHARToUTF8 InputName(*InInputName);
+    const uint32 InputCount = StateMachine->GetInputCount();
+    for (uint32 InputIndex = 0; InputIndex < InputCount; ++InputIndex)
+    {
+        rive::SMIInput* Input = StateMachine->GetInput(InputIndex);
+        if (Input && Input->name() == InputName.Get())
+        {
+            return MakeInputHandle(Input, InInputName);
+        }
+    }
+
+    UE_LOG(LogRive,
+           Warning,
+           TEXT("Could not find input '%s' on state machine '%s'"),
+           *InInputName,
+           *StateMachine->GetStateMachineName());
+    return {};
+}
+
+FRiveInputHandle URiveArtboard::GetInputHandleAtPath(
+    const FString& InInputName,
+    const FString& InPath) const
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        return {};
+    }
+
+    const FTCHARToUTF8 InputName(*InInputName);
+    const FTCHARToUTF8 Path(*InPath);
+    rive::SMIInput* Input =
+        NativeArtboardPtr->getBool(InputName.Get(), Path.Get());
+    if (!Input)
+    {
+        Input = NativeArtboardPtr->getNumber(InputName.Get(), Path.Get());
+    }
+    if (!Input)
+    {
+        Input = NativeArtboardPtr->getTrigger(InputName.Get(), Path.Get());
+    }
+
+    if (!Input)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        return {};
+    }
+
+    return MakeInputHandle(Input, InInputName);
+}
+
+FRiveInputHandle URiveArtboard::MakeInputHandle(
+    rive::SMIInput* InInput,
+    const FString& InInputName) const
+{
+    FRiveInputHandle Handle;
+    if (InInput->input()->is<rive::StateMachineBoolBase>())
+    {
+        Handle.Type = ERiveInputType::Bool;
+    }
+    else if (InInput->input()->is<rive::StateMachineNumberBase>())
+    {
+        Handle.Type = ERiveInputType::Number;
+    }
+    else if (InInput->input()->is<rive::StateMachineTriggerBase>())
+    {
+        Handle.Type = ERiveInputType::Trigger;
+    }
+    else
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input '%s' is of unknown type '%d'"),
+               *InInputName,
+               InInput->inputCoreType());
+        return {};
+    }
+
+    Handle.Name = InInputName;
+    Handle.Artboard = const_cast<URiveArtboard*>(this);
+    Handle.NativeInput = InInput;
+    Handle.Generation = InputGeneration;
+    return Handle;
+}
+
+bool URiveArtboard::IsInputHandleValid(const FRiveInputHandle& InHandle) const
+{
+    return InHandle.NativeInput != nullptr &&
+           InHandle.Generation == InputGeneration &&
+           InHandle.Artboard.Get() == this;
+}
+
+bool URiveArtboard::FireTriggerByHandle(const FRiveInputHandle& InHandle) const
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (!IsInputHandleValid(InHandle) ||
+        InHandle.Type != ERiveInputType::Trigger)
+    {
+        return false;
+    }
+
+    static_cast<rive::SMITrigger*>(InHandle.NativeInput)->fire();
+    bHasPendingChanges = true;
+    return true;
+}
+
+bool URiveArtboard::GetBoolValueByHandle(const FRiveInputHandle& InHandle) const
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (!IsInputHandleValid(InHandle) || InHandle.Type != ERiveInputType::Bool)
+    {
+        return false;
+    }
+
+    return static_cast<rive::SMIBool*>(InHandle.NativeInput)->value();
+}
+
+bool URiveArtboard::SetBoolValueByHandle(const FRiveInputHandle& InHandle,
+                                         bool bNewValue)
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (!IsInputHandleValid(InHandle) || InHandle.Type != ERiveInputType::Bool)
+    {
+        return false;
+    }
+
+    static_cast<rive::SMIBool*>(InHandle.NativeInput)->value(bNewValue);
+    bHasPendingChanges = true;
+    return true;
+}
+
+float URiveArtboard::GetNumberValueByHandle(
+    const FRiveInputHandle& InHandle) const
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (!IsInputHandleValid(InHandle) ||
+        InHandle.Type != ERiveInputType::Number)
+    {
+        return 0.f;
+    }
+
+    return static_cast<rive::SMINumber*>(InHandle.NativeInput)->value();
+}
+
+bool URiveArtboard::SetNumberValueByHandle(const FRiveInputHandle& InHandle,
+                                           float NewValue)
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    if (!IsInputHandleValid(InHandle) ||
+        InHandle.Type != ERiveInputType::Number)
+    {
+        return false;
+    }
 
-        if (!NativeArtboardPtr)
+    static_cast<rive::SMINumber*>(InHandle.NativeInput)->value(NewValue);
+    bHasPendingChanges = true;
+    return true;
+}
+
+int32 URiveArtboard::SetInputValues(const TArray<FRiveInputValue>& InValues,
+                                    TArray<int32>& OutFailedIndices)
+{
+    SCOPED_NAMED_EVENT_TEXT(TEXT("URiveArtboard::SetInputValues"),
+                            FColor::White);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("URiveArtboard::SetInputValues"),
+                                STAT_ARTBOARD_SETINPUTVALUES,
+                                STATGROUP_Rive);
+
+    OutFailedIndices.Reset();
+
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        for (int32 Index = 0; Index < InValues.Num(); ++Index)
         {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return;
+            OutFailedIndices.Add(Index);
         }
+        return 0;
+    }
+
+    FRiveStateMachine* StateMachine = GetStateMachine();
+    for (int32 Index = 0; Index < InValues.Num(); ++Index)
+    {
+        const FRiveInputValue& Value = InValues[Index];
+        const FTCHARToUTF8 Name(*Value.Name);
 
-        rive::TextValueRunBase* TextValueRun =
-            NativeArtboardPtr->getTextRun(TCHAR_TO_UTF8(*InInputName),
-                                          TCHAR_TO_UTF8(*InPath));
-        if (!TextValueRun)
+        bool bApplied = false;
+        if (Value.Type == ERiveInputValueType::Text)
         {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
+            rive::TextValueRunBase* TextValueRun =
+                Value.Path.IsEmpty()
+                    ? NativeArtboardPtr->find<rive::TextValueRunBase>(
+                          Name.Get())
+                    : NativeArtboardPtr->getTextRun(
+                          Name.Get(),
+                          TCHAR_TO_UTF8(*Value.Path));
+            if (TextValueRun)
+            {
+                TextValueRun->text(TCHAR_TO_UTF8(*Value.TextValue));
+                bApplied = true;
+            }
+        }
+        else if (Value.Path.IsEmpty())
+        {
+            bApplied = StateMachine &&
+                       StateMachine->ApplyInputValue(Value, Name.Get());
+        }
+        else
+        {
+            const FTCHARToUTF8 Path(*Value.Path);
+            switch (Value.Type)
+            {
+                case ERiveInputValueType::Bool:
+                {
+                    rive::SMIBool* SmiBool =
+                        NativeArtboardPtr->getBool(Name.Get(), Path.Get());
+                    if (SmiBool &&
+                        SmiBool->input()->is<rive::StateMachineBoolBase>())
+                    {
+                        SmiBool->value(Value.bBoolValue);
+                        bApplied = true;
+                    }
+                    break;
+                }
+                case ERiveInputValueType::Number:
+                {
+                    rive::SMINumber* SmiNumber =
+                        NativeArtboardPtr->getNumber(Name.Get(), Path.Get());
+                    if (SmiNumber &&
+                        SmiNumber->input()->is<rive::StateMachineNumberBase>())
+                    {
+                        SmiNumber->value(Value.NumberValue);
+                        bApplied = true;
+                    }
+                    break;
+                }
+                case ERiveInputValueType::Trigger:
+                {
+                    rive::SMITrigger* SmiTrigger =
+                        NativeArtboardPtr->getTrigger(Name.Get(), Path.Get());
+                    if (SmiTrigger && SmiTrigger->input()
+                                          ->is<rive::StateMachineTriggerBase>())
+                    {
+                        SmiTrigger->fire();
+                        bApplied = true;
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
         }
 
-        TextValueRun->text(TCHAR_TO_UTF8(*InValue));
-        OutSuccess = true;
+        if (!bApplied)
+        {
+            OutFailedIndices.Add(Index);
+        }
     }
 
-    OutSuccess = false;
+    bHasPendingChanges |= OutFailedIndices.Num() < InValues.Num();
+
+    if (OutFailedIndices.Num() > 0)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("SetInputValues: %d of %d values could not be applied on "
+                    "artboard '%s'"),
+               OutFailedIndices.Num(),
+               InValues.Num(),
+               *ArtboardName);
+    }
+
+    return InValues.Num() - OutFailedIndices.Num();
 }
 
 bool URiveArtboard::BindNamedRiveEvent(const FString& EventName,
@@ -587,6 +847,7 @@ bool URiveArtboard::UnbindNamedRiveEvent(const FString& EventName,
 bool URiveArtboard::TriggerNamedRiveEvent(const FString& EventName,
                                           float ReportedDelaySeconds)
 {
+    FRiveScopeLock Lock(&ArtboardCS.Get());
     if (NativeArtboardPtr && GetStateMachine())
     {
         if (rive::Component* Component =
@@ -728,7 +989,8 @@ void URiveArtboard::Initialize(URiveFile* InRiveFile,
         return;
     }
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock ArtboardLock(&ArtboardCS.Get());
 
     if (!RiveFile.IsValid() || !RiveFile->GetNativeFile())
     {
@@ -791,7 +1053,8 @@ void URiveArtboard::Initialize(URiveFile* InRiveFile,
         return;
     }
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock ArtboardLock(&ArtboardCS.Get());
 
     if (!RiveFile.IsValid() || !RiveFile->GetNativeFile())
     {
@@ -865,10 +1128,13 @@ void URiveArtboard::SetStateMachineName(const FString& NewStateMachineName)
 {
     if (StateMachineName != NewStateMachineName)
     {
+        FRiveScopeLock Lock(&ArtboardCS.Get());
         StateMachineName = NewStateMachineName;
+        ++InputGeneration;
 
         StateMachinePtr = MakeUnique<FRiveStateMachine>(NativeArtboardPtr.get(),
-                                                        StateMachineName);
+                                                        StateMachineName,
+                                                        ArtboardCS);
 
         if (CurrentViewModelInstance.IsValid())
             StateMachinePtr->SetViewModelInstance(
@@ -878,6 +1144,7 @@ void URiveArtboard::SetStateMachineName(const FString& NewStateMachineName)
 
 void URiveArtboard::SetAudioEngine(URiveAudioEngine* AudioEngine)
 {
+    FRiveScopeLock Lock(&ArtboardCS.Get());
     if (AudioEngine == nullptr)
     {
         rive::rcp<rive::AudioEngine> NativeEngine =
@@ -919,19 +1186,32 @@ void URiveArtboard::Tick_StateMachine(float InDeltaSeconds)
     {
         OnArtboardTick_StateMachine.Execute(InDeltaSeconds, this);
     }
-    else
+    else if (LastAdvanceFrame != GFrameCounter)
     {
         AdvanceStateMachine(InDeltaSeconds);
     }
+    else if (bHasPendingChanges)
+    {
+        // FRiveTickManager already advanced it this frame, apply the inputs
+        // set since then without moving time forward
+        AdvanceStateMachine(0.f);
+    }
 }
 
 void URiveArtboard::Deinitialize()
 {
     if (this == nullptr)
         return;
+
+    FRiveTickManager::Get().Unregister(this);
+
+    FRiveScopeLock Lock(&ArtboardCS.Get());
     bIsInitialized = false;
+    ++InputGeneration;
 
     StateMachinePtr.Reset();
+    // The render thread may still be drawing the native artboard, so it is
+    // released rather than deleted here
     if (NativeArtboardPtr != nullptr)
     {
         NativeArtboardPtr.release();
@@ -948,23 +1228,15 @@ void URiveArtboard::Tick(float InDeltaSeconds)
         return;
     }
 
+    LastTickFrame = GFrameCounter;
+    LastTickDeltaSeconds = InDeltaSeconds;
     Tick_StateMachine(InDeltaSeconds);
     Tick_Render(InDeltaSeconds);
 }
 
 rive::ArtboardInstance* URiveArtboard::GetNativeArtboard() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to retrieve the NativeArtboard as we do not have"
-                    " a valid renderer."));
-        return nullptr;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeArtboardPtr)
     {
@@ -981,17 +1253,7 @@ rive::ArtboardInstance* URiveArtboard::GetNativeArtboard() const
 
 rive::AABB URiveArtboard::GetBounds() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetBounds for the Artboard as we do not have"
-                    " a valid renderer."));
-        return {};
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeArtboardPtr)
     {
@@ -1008,6 +1270,7 @@ rive::AABB URiveArtboard::GetBounds() const
 
 FVector2f URiveArtboard::GetOriginalSize() const
 {
+    FRiveScopeLock Lock(&ArtboardCS.Get());
     if (!NativeArtboardPtr)
         return FVector2f::ZeroVector;
 
@@ -1017,17 +1280,7 @@ FVector2f URiveArtboard::GetOriginalSize() const
 
 FVector2f URiveArtboard::GetSize() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetSize for the Artboard as we do not have a "
-                    "valid renderer."));
-        return {};
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeArtboardPtr)
     {
@@ -1044,17 +1297,7 @@ FVector2f URiveArtboard::GetSize() const
 
 void URiveArtboard::SetSize(FVector2f InVector)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to SetSize for the Artboard as we do not have a "
-                    "valid renderer."));
-        return;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeArtboardPtr)
     {
@@ -1068,23 +1311,14 @@ void URiveArtboard::SetSize(FVector2f InVector)
 
     NativeArtboardPtr->width(InVector.X);
     NativeArtboardPtr->height(InVector.Y);
+    bHasPendingChanges = true;
 
     return;
 }
 
 FRiveStateMachine* URiveArtboard::GetStateMachine() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetStateMachine for the Artboard as we do not "
-                    "have a valid renderer."));
-        return nullptr;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!StateMachinePtr)
     {
@@ -1102,23 +1336,34 @@ void URiveArtboard::PopulateReportedEvents()
 
     if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        const int32 NumReportedEvents = StateMachine->GetReportedEventsCount();
-        TickRiveReportedEvents.Reserve(NumReportedEvents);
-
-        for (int32 EventIndex = 0; EventIndex < NumReportedEvents; EventIndex++)
         {
-            const rive::EventReport ReportedEvent =
-                StateMachine->GetReportedEvent(EventIndex);
-            if (ReportedEvent.event() != nullptr)
+            // Only hold the artboard while reading the reports, delegates are
+            // broadcast once it has been released
+            FRiveScopeLock Lock(&ArtboardCS.Get());
+            const int32 NumReportedEvents =
+                StateMachine->GetReportedEventsCount();
+            TickRiveReportedEvents.Reserve(NumReportedEvents);
+
+            for (int32 EventIndex = 0; EventIndex < NumReportedEvents;
+                 EventIndex++)
             {
-                FRiveEvent RiveEvent;
-                RiveEvent.Initialize(ReportedEvent);
-                if (const FRiveNamedEventsDelegate* NamedEventDelegate =
-                        NamedRiveEventsDelegates.Find(RiveEvent.Name))
+                const rive::EventReport ReportedEvent =
+                    StateMachine->GetReportedEvent(EventIndex);
+                if (ReportedEvent.event() != nullptr)
                 {
-                    NamedEventDelegate->Broadcast(this, RiveEvent);
+                    FRiveEvent RiveEvent;
+                    RiveEvent.Initialize(ReportedEvent);
+                    TickRiveReportedEvents.Add(MoveTemp(RiveEvent));
                 }
-                TickRiveReportedEvents.Add(MoveTemp(RiveEvent));
+            }
+        }
+
+        for (const FRiveEvent& RiveEvent : TickRiveReportedEvents)
+        {
+            if (const FRiveNamedEventsDelegate* NamedEventDelegate =
+                    NamedRiveEventsDelegates.Find(RiveEvent.Name))
+            {
+                NamedEventDelegate->Broadcast(this, RiveEvent);
             }
         }
 
@@ -1141,6 +1386,8 @@ void URiveArtboard::PopulateReportedEvents()
 
 void URiveArtboard::Initialize_Internal(const rive::Artboard* InNativeArtboard)
 {
+    ++InputGeneration;
+    bHasPendingChanges = true;
     NativeArtboardPtr = InNativeArtboard->instance();
     if (!NativeArtboardPtr)
     {
@@ -1152,6 +1399,13 @@ void URiveArtboard::Initialize_Internal(const rive::Artboard* InNativeArtboard)
     }
 
     ArtboardName = FString{NativeArtboardPtr->name().c_str()};
+    TraceName = FString::Printf(TEXT("%s/%s"),
+                                *GetNameSafe(RiveFile.Get()),
+                                *ArtboardName);
+    if (RiveFile.IsValid())
+    {
+        RiveFile->RequestArtboardAssets(*InNativeArtboard, AssetLoadPriority);
+    }
     NativeArtboardPtr->advance(0);
 
     // UI Helpers
@@ -1164,7 +1418,8 @@ void URiveArtboard::Initialize_Internal(const rive::Artboard* InNativeArtboard)
     }
 
     StateMachinePtr = MakeUnique<FRiveStateMachine>(NativeArtboardPtr.get(),
-                                                    StateMachineName);
+                                                    StateMachineName,
+                                                    ArtboardCS);
 
     // Update our active StateMachineNAme with our actual state machine name
     StateMachineName = StateMachinePtr->GetStateMachineName();
@@ -1179,6 +1434,7 @@ void URiveArtboard::Initialize_Internal(const rive::Artboard* InNativeArtboard)
     }
 
     bIsInitialized = true;
+    FRiveTickManager::Get().Register(this);
 }
 
 void URiveArtboard::SetViewModelInstance(
@@ -1188,6 +1444,8 @@ void URiveArtboard::SetViewModelInstance(
     // it on dynamically created state machines.
     CurrentViewModelInstance = RiveViewModelInstance;
 
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+
     if (!NativeArtboardPtr)
     {
         UE_LOG(LogRive,
@@ -1212,6 +1470,7 @@ void URiveArtboard::SetViewModelInstance(
 
     // Set the data context on the artboard
     NativeArtboardPtr->bindViewModelInstance(NativeInstance->instance());
+    bHasPendingChanges = true;
 
     // Set the data context on the state machine if it exists.
     FRiveStateMachine* StateMachine = GetStateMachine();
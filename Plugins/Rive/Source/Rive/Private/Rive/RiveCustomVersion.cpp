@@ -0,0 +1,15 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveCustomVersion.h"
+
+#include "Serialization/CustomVersion.h"
+
+const FGuid FRiveCustomVersion::GUID(0x9D9A1595,
+                                     0x17A548E6,
+                                     0x97591927,
+                                     0xABB668A7);
+
+static FCustomVersionRegistration GRegisterRiveCustomVersion(
+    FRiveCustomVersion::GUID,
+    FRiveCustomVersion::LatestVersion,
+    TEXT("RiveVer"));
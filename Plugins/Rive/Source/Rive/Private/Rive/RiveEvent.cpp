@@ -2,8 +2,6 @@
 
 #include "Rive/RiveEvent.h"
 
-#include "IRiveRenderer.h"
-#include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
 
 #if WITH_RIVE
@@ -19,18 +17,8 @@ THIRD_PARTY_INCLUDES_END
 
 void FRiveEvent::Initialize(const rive::EventReport& InEventReport)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to Initialize the RiveEvent as we do not have a "
-                    "valid renderer."));
-        return;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
+    // Event reports are read while the owning artboard is locked, see
+    // URiveArtboard::PopulateReportedEvents
     DelayInSeconds = InEventReport.secondsDelay();
 
     RiveEventBoolProperties.Reset();
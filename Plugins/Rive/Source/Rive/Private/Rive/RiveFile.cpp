@@ -4,11 +4,20 @@
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
+#include "Rive/Assets/RiveAssetHelpers.h"
+#include "Rive/Assets/RiveDecodedAssetCache.h"
 #include "Rive/Assets/RiveFileAssetImporter.h"
 #include "Rive/Assets/RiveFileAssetLoader.h"
+#include "Rive/Assets/RiveFileCooker.h"
+#include "Rive/Assets/RiveImageAsset.h"
 #include "Rive/ViewModel/RiveViewModel.h"
 #include "Rive/RiveArtboard.h"
+#include "Rive/RiveCustomVersion.h"
+#include "Async/Async.h"
 #include "Blueprint/UserWidget.h"
+#include "HAL/IConsoleManager.h"
+#include "RiveStats.h"
+#include "UObject/StrongObjectPtr.h"
 
 #if WITH_EDITOR
 #include "EditorFramework/AssetImportData.h"
@@ -16,19 +25,218 @@
 
 #if WITH_RIVE
 THIRD_PARTY_INCLUDES_START
+#include "rive/animation/state_machine.hpp"
 #include "rive/animation/state_machine_input.hpp"
+#include "rive/assets/file_asset.hpp"
+#include "rive/assets/font_asset.hpp"
+#include "rive/assets/image_asset.hpp"
+#include "rive/audio_event.hpp"
+#include "rive/event.hpp"
+#include "rive/generated/animation/state_machine_bool_base.hpp"
+#include "rive/generated/animation/state_machine_number_base.hpp"
+#include "rive/generated/animation/state_machine_trigger_base.hpp"
+#include "rive/image.hpp"
+#include "rive/nested_artboard.hpp"
+#include "rive/renderer.hpp"
 #include "rive/renderer/render_context.hpp"
+#include "rive/text/text_style.hpp"
+#include "rive/text_engine.hpp"
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 
 class FRiveFileAssetImporter;
 class FRiveFileAssetLoader;
 
+static TAutoConsoleVariable<int32> CVarRiveAsyncFileImport(
+    TEXT("r.rive.asyncfileimport"),
+    1,
+    TEXT("If non 0, rive files are parsed and their assets decoded on a "
+         "background thread, and only report their initialization on the game "
+         "thread. Renderers that can't decode off their own thread, and editor "
+         "imports, always load synchronously."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRiveCookedImages(
+    TEXT("r.rive.cookedimages"),
+    1,
+    TEXT("If non 0, cooked rive files upload the images decoded at cook time "
+         "instead of decoding them, when the renderer can upload raw pixels."),
+    ECVF_Default);
+
+#if WITH_RIVE
+namespace UE::Private::RiveFile
+{
+std::unique_ptr<rive::File> ImportNativeFile(rive::Span<const uint8> InFileSpan,
+                                             IRiveRenderer* InRiveRenderer,
+                                             rive::FileAssetLoader* InLoader)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("URiveFile Import"),
+                                STAT_RiveFileImport,
+                                STATGROUP_Rive);
+
+    // Parsing only makes CPU side paths, paints and buffers, and images are
+    // decoded later by DecodePendingImages under the renderer's lock. Only
+    // factories that can't be used off the renderer's thread need the lock
+    // for the whole import.
+    TOptional<FScopeLock> Lock;
+    if (!InRiveRenderer->SupportsWorkerThreadDecode())
+    {
+        Lock.Emplace(&InRiveRenderer->GetThreadDataCS());
+    }
+    rive::ImportResult ImportResult;
+    std::unique_ptr<rive::File> NativeFile =
+        rive::File::import(InFileSpan,
+                           InRiveRenderer->GetFactory(),
+                           &ImportResult,
+                           InLoader);
+    if (ImportResult != rive::ImportResult::success)
+    {
+        return nullptr;
+    }
+    return NativeFile;
+}
+
+ERiveInputType GetInputType(const rive::StateMachineInput& InInput)
+{
+    if (InInput.is<rive::StateMachineBoolBase>())
+    {
+        return ERiveInputType::Bool;
+    }
+    if (InInput.is<rive::StateMachineNumberBase>())
+    {
+        return ERiveInputType::Number;
+    }
+    if (InInput.is<rive::StateMachineTriggerBase>())
+    {
+        return ERiveInputType::Trigger;
+    }
+    return ERiveInputType::None;
+}
+
+void ReadArtboardMetadata(rive::Artboard& InArtboard,
+                          FRiveArtboardMetadata& OutMetadata)
+{
+    OutMetadata.Name = UTF8_TO_TCHAR(InArtboard.name().c_str());
+    OutMetadata.Size = FVector2f(InArtboard.width(), InArtboard.height());
+
+    OutMetadata.StateMachines.Reserve(InArtboard.stateMachineCount());
+    for (size_t i = 0; i < InArtboard.stateMachineCount(); ++i)
+    {
+        const rive::StateMachine* StateMachine = InArtboard.stateMachine(i);
+        FRiveStateMachineMetadata& StateMachineMetadata =
+            OutMetadata.StateMachines.AddDefaulted_GetRef();
+        StateMachineMetadata.Name = UTF8_TO_TCHAR(StateMachine->name().c_str());
+
+        StateMachineMetadata.Inputs.Reserve(StateMachine->inputCount());
+        for (size_t j = 0; j < StateMachine->inputCount(); ++j)
+        {
+            const rive::StateMachineInput* Input = StateMachine->input(j);
+            FRiveStateMachineInputMetadata& InputMetadata =
+                StateMachineMetadata.Inputs.AddDefaulted_GetRef();
+            InputMetadata.Name = UTF8_TO_TCHAR(Input->name().c_str());
+            InputMetadata.Type = GetInputType(*Input);
+        }
+    }
+
+    for (const rive::Event* Event : InArtboard.find<rive::Event>())
+    {
+        OutMetadata.EventNames.Add(UTF8_TO_TCHAR(Event->name().c_str()));
+    }
+}
+
+/**
+ * Decodes the bytes of an asset loaded on demand through the decoded asset
+ * cache, into OutImage or OutFont depending on its type
+ */
+void DecodeOnDemandAsset(IRiveRenderer* InRiveRenderer,
+                         URiveAsset& InAsset,
+                         rive::rcp<rive::RenderImage>& OutImage,
+                         rive::rcp<rive::Font>& OutFont)
+{
+    TArray<uint8> Bytes;
+    InAsset.GetNativeAssetBytes(Bytes);
+    const rive::Span<const uint8> Span =
+        rive::make_span(Bytes.GetData(), Bytes.Num());
+
+    FScopeLock Lock(&InRiveRenderer->GetThreadDataCS());
+    if (InAsset.Type == ERiveAssetType::Image)
+    {
+        OutImage = FRiveDecodedAssetCache::Get().FindOrDecodeImage(
+            Span,
+            InRiveRenderer->GetFactory());
+    }
+    else if (InAsset.Type == ERiveAssetType::Font)
+    {
+        OutFont = FRiveDecodedAssetCache::Get().FindOrDecodeFont(
+            Span,
+            InRiveRenderer->GetFactory());
+    }
+}
+
+/** Adds the ids of the assets InArtboard, and the artboards it nests, use */
+void CollectArtboardAssetIds(const rive::File& InFile,
+                             const rive::Artboard& InArtboard,
+                             TSet<const rive::Artboard*>& InOutVisited,
+                             TSet<uint32>& OutAssetIds)
+{
+    bool bIsAlreadyVisited = false;
+    InOutVisited.Add(&InArtboard, &bIsAlreadyVisited);
+    if (bIsAlreadyVisited)
+    {
+        return;
+    }
+
+    for (const rive::Core* Object : InArtboard.objects())
+    {
+        const rive::FileAsset* Asset = nullptr;
+        if (Object == nullptr)
+        {
+            continue;
+        }
+        if (Object->is<rive::Image>())
+        {
+            Asset = Object->as<rive::Image>()->imageAsset();
+        }
+        else if (Object->is<rive::TextStyle>())
+        {
+            Asset = Object->as<rive::TextStyle>()->fontAsset();
+        }
+        else if (Object->is<rive::AudioEvent>())
+        {
+            Asset = Object->as<rive::AudioEvent>()->asset();
+        }
+        else if (Object->is<rive::NestedArtboard>())
+        {
+            if (const rive::Artboard* NestedArtboard = InFile.artboard(
+                    Object->as<rive::NestedArtboard>()->artboardId()))
+            {
+                CollectArtboardAssetIds(InFile,
+                                        *NestedArtboard,
+                                        InOutVisited,
+                                        OutAssetIds);
+            }
+        }
+
+        if (Asset != nullptr)
+        {
+            OutAssetIds.Add(Asset->assetId());
+        }
+    }
+}
+} // namespace UE::Private::RiveFile
+#endif // WITH_RIVE
+
 void URiveFile::BeginDestroy()
 {
     InitState = ERiveInitState::Deinitializing;
     RiveNativeFileSpan = {};
+    ImportBytes.Empty();
     RiveNativeFilePtr.reset();
+#if WITH_RIVE
+    // Images and fonts only this file used can go now rather than on the next
+    // decode
+    FRiveDecodedAssetCache::Get().RemoveUnused();
+#endif // WITH_RIVE
     UObject::BeginDestroy();
 }
 
@@ -61,6 +269,79 @@ void URiveFile::PostLoad()
 #endif
 }
 
+void URiveFile::Serialize(FArchive& Ar)
+{
+    UObject::Serialize(Ar);
+
+    Ar.UsingCustomVersion(FRiveCustomVersion::GUID);
+    if (Ar.IsLoading() && Ar.CustomVer(FRiveCustomVersion::GUID) <
+                              FRiveCustomVersion::BulkDataPayloads)
+    {
+        RiveAssetHelpers::SetBulkData(RiveFileBulkData,
+                                      RiveFileData_DEPRECATED);
+        RiveFileData_DEPRECATED.Empty();
+        return;
+    }
+
+    RiveFileBulkData.Serialize(Ar, this);
+
+    if (Ar.CustomVer(FRiveCustomVersion::GUID) >=
+        FRiveCustomVersion::CookedImages)
+    {
+        bool bCooked = Ar.IsCooking();
+        Ar << bCooked;
+        if (bCooked)
+        {
+            Ar << CookedImages;
+            CookedImageBulkData.Serialize(Ar, this);
+        }
+    }
+}
+
+#if WITH_EDITOR
+void URiveFile::BeginCacheForCookedPlatformData(
+    const ITargetPlatform* TargetPlatform)
+{
+    UObject::BeginCacheForCookedPlatformData(TargetPlatform);
+
+#if WITH_RIVE
+    // The decoded images are the same for every platform
+    if (!CookedImages.IsEmpty())
+    {
+        return;
+    }
+
+    TArray<uint8> FileBytes;
+    TArray<uint8> Pixels;
+    RiveAssetHelpers::ReadBulkData(RiveFileBulkData, FileBytes);
+    if (!FRiveFileCooker::CookImages(GetName(),
+                                     FileBytes,
+                                     Assets,
+                                     CookedImages,
+                                     Pixels))
+    {
+        // Logged as an error so the cook fails instead of shipping a file
+        // that can't load
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Rive file '%s' could not be imported, it would fail to "
+                    "load once cooked."),
+               *GetPathName());
+        return;
+    }
+    RiveAssetHelpers::SetBulkData(CookedImageBulkData, Pixels);
+#endif // WITH_RIVE
+}
+
+void URiveFile::ClearAllCachedCookedPlatformData()
+{
+    UObject::ClearAllCachedCookedPlatformData();
+
+    CookedImages.Empty();
+    CookedImageBulkData.RemoveBulkData();
+}
+#endif // WITH_EDITOR
+
 void URiveFile::Initialize()
 {
     if (!(InitState == ERiveInitState::Uninitialized ||
@@ -71,6 +352,7 @@ void URiveFile::Initialize()
 
     WasLastInitializationSuccessful.Reset();
     InitState = ERiveInitState::Initializing;
+    ++ImportGeneration;
     OnStartInitializingDelegate.Broadcast();
 
     if (!IRiveRendererModule::IsAvailable())
@@ -96,18 +378,21 @@ void URiveFile::Initialize()
     }
 
 #if WITH_RIVE
-    if (RiveNativeFileSpan.empty() || bNeedsImport)
+    RiveAssetHelpers::ReadBulkData(RiveFileBulkData, ImportBytes);
+    if (ImportBytes.IsEmpty())
     {
-        if (RiveFileData.IsEmpty())
-        {
-            UE_LOG(LogRive,
-                   Error,
-                   TEXT("Could not load an empty Rive File Data."));
-            BroadcastInitializationResult(false);
-            return;
-        }
-        RiveNativeFileSpan =
-            rive::make_span(RiveFileData.GetData(), RiveFileData.Num());
+        UE_LOG(LogRive, Error, TEXT("Could not load an empty Rive File Data."));
+        BroadcastInitializationResult(false);
+        return;
+    }
+    RiveNativeFileSpan =
+        rive::make_span(ImportBytes.GetData(), ImportBytes.Num());
+
+    if (!CookedImages.IsEmpty() &&
+        CVarRiveCookedImages.GetValueOnGameThread() != 0 &&
+        RiveRenderer->SupportsRawImagePixels())
+    {
+        RiveAssetHelpers::ReadBulkData(CookedImageBulkData, CookedImagePixels);
     }
 
     InitState = ERiveInitState::Initializing;
@@ -115,98 +400,435 @@ void URiveFile::Initialize()
     RiveRenderer->CallOrRegister_OnInitialized(
         IRiveRenderer::FOnRendererInitialized::FDelegate::CreateLambda(
             [this](IRiveRenderer* RiveRenderer) {
-                rive::gpu::RenderContext* RenderContext;
+                rive::Factory* Factory;
                 {
                     FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-                    RenderContext = RiveRenderer->GetRenderContext();
+                    Factory = RiveRenderer->GetFactory();
                 }
 
-                if (ensure(RenderContext))
+                if (!ensure(Factory))
                 {
-                    ArtboardNames.Empty();
-                    Artboards.Empty();
-                    ViewModels.Empty();
+                    UE_LOG(LogRive, Error, TEXT("Failed to import rive file."));
+                    BroadcastInitializationResult(false);
+                    return;
+                }
 
-                    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-                    rive::ImportResult ImportResult;
+                ArtboardNames.Empty();
+                ArtboardMetadata.Empty();
+                ViewModels.Empty();
 
-#if WITH_EDITORONLY_DATA
-                    if (bNeedsImport)
-                    {
-                        bNeedsImport = false;
-                        const TUniquePtr<FRiveFileAssetImporter> AssetImporter =
-                            MakeUnique<FRiveFileAssetImporter>(
-                                GetOutermost(),
-                                AssetImportData->GetFirstFilename(),
-                                GetAssets());
-                        RiveNativeFilePtr =
-                            rive::File::import(RiveNativeFileSpan,
-                                               RenderContext,
-                                               &ImportResult,
-                                               AssetImporter.Get());
-                        if (ImportResult != rive::ImportResult::success)
-                        {
-                            UE_LOG(LogRive,
-                                   Error,
-                                   TEXT("Failed to import rive file."));
-                            Lock.Unlock();
-                            BroadcastInitializationResult(false);
-                            return;
-                        }
-                    }
-#endif
+                const double StartTime = FPlatformTime::Seconds();
 
-                    const TUniquePtr<FRiveFileAssetLoader> FileAssetLoader =
-                        MakeUnique<FRiveFileAssetLoader>(this, Assets);
-                    RiveNativeFilePtr =
-                        rive::File::import(RiveNativeFileSpan,
-                                           RenderContext,
-                                           &ImportResult,
-                                           FileAssetLoader.Get());
+                // Editor imports create assets and report their result right
+                // away, so they stay on the game thread
+                if (!bNeedsImport &&
+                    CVarRiveAsyncFileImport.GetValueOnGameThread() != 0 &&
+                    RiveRenderer->SupportsWorkerThreadDecode())
+                {
+                    ImportAsync(RiveRenderer, StartTime);
+                    return;
+                }
 
-                    if (ImportResult != rive::ImportResult::success)
+#if WITH_EDITORONLY_DATA
+                if (bNeedsImport)
+                {
+                    bNeedsImport = false;
+                    const TUniquePtr<FRiveFileAssetImporter> AssetImporter =
+                        MakeUnique<FRiveFileAssetImporter>(
+                            GetOutermost(),
+                            AssetImportData->GetFirstFilename(),
+                            GetAssets());
+                    if (!UE::Private::RiveFile::ImportNativeFile(
+                            RiveNativeFileSpan,
+                            RiveRenderer,
+                            AssetImporter.Get()))
                     {
                         UE_LOG(LogRive,
                                Error,
-                               TEXT("Failed to load rive file."));
-                        Lock.Unlock();
+                               TEXT("Failed to import rive file."));
                         BroadcastInitializationResult(false);
                         return;
                     }
+                }
+#endif
 
-                    // UI Helpers
-                    for (int i = 0; i < RiveNativeFilePtr->artboardCount(); ++i)
-                    {
-                        auto Artboard = NewObject<URiveArtboard>();
+                const TUniquePtr<FRiveFileAssetLoader> FileAssetLoader =
+                    MakeUnique<FRiveFileAssetLoader>(this, Assets);
+                FileAssetLoader->SetCookedImages(CookedImages,
+                                                 CookedImagePixels);
+                FileAssetLoader->SetLoadOutOfBandAssetsOnDemand(
+                    bLoadAssetsOnDemand);
+                std::unique_ptr<rive::File> NativeFile =
+                    UE::Private::RiveFile::ImportNativeFile(
+                        RiveNativeFileSpan,
+                        RiveRenderer,
+                        FileAssetLoader.Get());
+                if (NativeFile)
+                {
+                    FileAssetLoader->DecodePendingImages(RiveRenderer);
+                }
+                FinishInitialization(MoveTemp(NativeFile), StartTime, false);
+            }));
+#endif // WITH_RIVE
+}
 
-                        // We won't tick the artboard, it's just
-                        // initialized for informational purposes.
-                        Artboard->Initialize(this, nullptr, i, "");
-                        Artboards.Add(Artboard);
-                        ArtboardNames.Add(Artboard->GetArtboardName());
-                    }
+#if WITH_RIVE
 
-                    for (int i = 0; i < RiveNativeFilePtr->viewModelCount();
-                         ++i)
-                    {
-                        auto ViewModel = NewObject<URiveViewModel>();
-                        ViewModel->Initialize(
-                            RiveNativeFilePtr->viewModelByIndex(i));
-                        ViewModels.Add(ViewModel);
-                    }
+void URiveFile::ImportAsync(IRiveRenderer* InRiveRenderer, double InStartTime)
+{
+    check(IsInGameThread());
 
-                    BroadcastInitializationResult(true);
-                    return;
+    const TSharedRef<FRiveFileAssetLoader> FileAssetLoader =
+        MakeShared<FRiveFileAssetLoader>(this, Assets, true);
+    FileAssetLoader->ReplaceOutdatedAssets();
+    FileAssetLoader->SetCookedImages(CookedImages, CookedImagePixels);
+    FileAssetLoader->SetLoadOutOfBandAssetsOnDemand(bLoadAssetsOnDemand);
+
+    // The strong pointer keeps this file, its data and its assets alive until
+    // the import is done, it is only released on the game thread
+    AsyncTask(
+        ENamedThreads::AnyBackgroundThreadNormalTask,
+        [StrongThis = TStrongObjectPtr<URiveFile>(this),
+         InRiveRenderer,
+         FileAssetLoader,
+         FileSpan = RiveNativeFileSpan,
+         InStartTime]() mutable {
+            std::unique_ptr<rive::File> NativeFile =
+                UE::Private::RiveFile::ImportNativeFile(FileSpan,
+                                                        InRiveRenderer,
+                                                        &FileAssetLoader.Get());
+            if (NativeFile)
+            {
+                FileAssetLoader->DecodePendingImages(InRiveRenderer);
+            }
+
+            AsyncTask(ENamedThreads::GameThread,
+                      [StrongThis = MoveTemp(StrongThis),
+                       FileAssetLoader,
+                       NativeFile = MoveTemp(NativeFile),
+                       InStartTime]() mutable {
+                          if (NativeFile)
+                          {
+                              FileAssetLoader->CreateDeferredAssets();
+                          }
+                          StrongThis->FinishInitialization(MoveTemp(NativeFile),
+                                                           InStartTime,
+                                                           true);
+                      });
+        });
+}
+
+void URiveFile::FinishInitialization(std::unique_ptr<rive::File> InNativeFile,
+                                     double InStartTime,
+                                     bool bInAsync)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("URiveFile::FinishInitialization"),
+                                STAT_URiveFile_FinishInitialization,
+                                STATGROUP_Rive);
+
+    if (!InNativeFile)
+    {
+        UE_LOG(LogRive, Error, TEXT("Failed to load rive file."));
+        BroadcastInitializationResult(false);
+        return;
+    }
+
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    {
+        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+        RiveNativeFilePtr = MoveTemp(InNativeFile);
+
+        // UI Helpers, read from the definitions so nothing gets instanced
+        ArtboardMetadata.Reserve(RiveNativeFilePtr->artboardCount());
+        for (int i = 0; i < RiveNativeFilePtr->artboardCount(); ++i)
+        {
+            FRiveArtboardMetadata& Metadata =
+                ArtboardMetadata.AddDefaulted_GetRef();
+            UE::Private::RiveFile::ReadArtboardMetadata(
+                *RiveNativeFilePtr->artboard(i),
+                Metadata);
+            ArtboardNames.Add(Metadata.Name);
+        }
+
+        for (int i = 0; i < RiveNativeFilePtr->viewModelCount(); ++i)
+        {
+            auto ViewModel = NewObject<URiveViewModel>();
+            ViewModel->Initialize(RiveNativeFilePtr->viewModelByIndex(i));
+            ViewModels.Add(ViewModel);
+        }
+    }
+
+    if (PlaceholderImage != nullptr)
+    {
+        for (const TPair<uint32, TObjectPtr<URiveAsset>>& Asset : Assets)
+        {
+            URiveImageAsset* ImageAsset = Cast<URiveImageAsset>(Asset.Value);
+            if (ImageAsset != nullptr &&
+                ImageAsset->OnDemandLoadState != ERiveOnDemandLoadState::None)
+            {
+                ImageAsset->LoadTexture(PlaceholderImage);
+            }
+        }
+    }
+
+    UE_LOG(LogRive,
+           Verbose,
+           TEXT("Loaded rive file '%s' in %.2f ms (%s), released %d bytes of "
+                "file data"),
+           *GetName(),
+           (FPlatformTime::Seconds() - InStartTime) * 1000.0,
+           bInAsync ? TEXT("async") : TEXT("sync"),
+           ImportBytes.Num());
+
+    BroadcastInitializationResult(true);
+}
+
+void URiveFile::RequestArtboardAssets(const rive::Artboard& InArtboard,
+                                      ERiveAssetLoadPriority InPriority)
+{
+    if (!bLoadAssetsOnDemand)
+    {
+        return;
+    }
+
+    TArray<URiveAsset*> OnDemandAssets;
+    FindOnDemandAssets(InArtboard, OnDemandAssets);
+    for (URiveAsset* Asset : OnDemandAssets)
+    {
+        LoadAssetOnDemand(Asset, InPriority);
+    }
+}
+
+void URiveFile::FindOnDemandAssets(const rive::Artboard& InArtboard,
+                                   TArray<URiveAsset*>& OutAssets) const
+{
+    if (!RiveNativeFilePtr)
+    {
+        return;
+    }
+
+    TSet<const rive::Artboard*> VisitedArtboards;
+    TSet<uint32> AssetIds;
+    UE::Private::RiveFile::CollectArtboardAssetIds(*RiveNativeFilePtr,
+                                                   InArtboard,
+                                                   VisitedArtboards,
+                                                   AssetIds);
+    for (const uint32 AssetId : AssetIds)
+    {
+        const TObjectPtr<URiveAsset>* Asset = Assets.Find(AssetId);
+        if (Asset != nullptr && *Asset != nullptr &&
+            (*Asset)->OnDemandLoadState != ERiveOnDemandLoadState::None)
+        {
+            OutAssets.AddUnique(*Asset);
+        }
+    }
+}
+
+void URiveFile::FindOnDemandAssets(const TArray<FString>& InArtboardNames,
+                                   TArray<URiveAsset*>& OutAssets) const
+{
+    if (!RiveNativeFilePtr)
+    {
+        return;
+    }
+
+    if (InArtboardNames.IsEmpty())
+    {
+        for (const TPair<uint32, TObjectPtr<URiveAsset>>& Asset : Assets)
+        {
+            if (Asset.Value != nullptr &&
+                Asset.Value->OnDemandLoadState != ERiveOnDemandLoadState::None)
+            {
+                OutAssets.Add(Asset.Value);
+            }
+        }
+        return;
+    }
+
+    for (const FString& ArtboardName : InArtboardNames)
+    {
+        const rive::Artboard* Artboard =
+            RiveNativeFilePtr->artboard(TCHAR_TO_UTF8(*ArtboardName));
+        if (Artboard == nullptr)
+        {
+            UE_LOG(LogRive,
+                   Warning,
+                   TEXT("Rive file '%s' has no artboard named '%s'"),
+                   *GetName(),
+                   *ArtboardName);
+            continue;
+        }
+        FindOnDemandAssets(*Artboard, OutAssets);
+    }
+}
+
+void URiveFile::LoadAssetOnDemand(URiveAsset* InAsset,
+                                  ERiveAssetLoadPriority InPriority)
+{
+    check(IsInGameThread());
+
+    // A load in flight keeps the priority it started with
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    if (InAsset->OnDemandLoadState != ERiveOnDemandLoadState::Pending ||
+        RiveRenderer == nullptr)
+    {
+        return;
+    }
+    InAsset->OnDemandLoadState = ERiveOnDemandLoadState::Loading;
+
+    if (InPriority == ERiveAssetLoadPriority::High ||
+        !RiveRenderer->SupportsWorkerThreadDecode())
+    {
+        rive::rcp<rive::RenderImage> Image;
+        rive::rcp<rive::Font> Font;
+        UE::Private::RiveFile::DecodeOnDemandAsset(RiveRenderer,
+                                                   *InAsset,
+                                                   Image,
+                                                   Font);
+        FinishAssetLoad(InAsset, MoveTemp(Image), MoveTemp(Font));
+        return;
+    }
+
+    // The worker reads and decodes the bytes, the game thread only applies
+    // the result
+    AsyncTask(
+        InPriority == ERiveAssetLoadPriority::Low
+            ? ENamedThreads::AnyBackgroundThreadNormalTask
+            : ENamedThreads::AnyNormalThreadNormalTask,
+        [WeakThis = TWeakObjectPtr<URiveFile>(this),
+         StrongAsset = TStrongObjectPtr<URiveAsset>(InAsset),
+         Generation = ImportGeneration,
+         RiveRenderer]() mutable {
+            rive::rcp<rive::RenderImage> Image;
+            rive::rcp<rive::Font> Font;
+            UE::Private::RiveFile::DecodeOnDemandAsset(RiveRenderer,
+                                                       *StrongAsset,
+                                                       Image,
+                                                       Font);
+
+            // Image and Font keep the cache entries alive until applied
+            AsyncTask(ENamedThreads::GameThread,
+                      [WeakThis,
+                       StrongAsset = MoveTemp(StrongAsset),
+                       Generation,
+                       Image = MoveTemp(Image),
+                       Font = MoveTemp(Font)]() mutable {
+                          if (WeakThis.IsValid() &&
+                              WeakThis->ImportGeneration == Generation)
+                          {
+                              WeakThis->FinishAssetLoad(StrongAsset.Get(),
+                                                        MoveTemp(Image),
+                                                        MoveTemp(Font));
+                          }
+                      });
+        });
+}
+
+void URiveFile::FinishAssetLoad(URiveAsset* InAsset,
+                                rive::rcp<rive::RenderImage> InImage,
+                                rive::rcp<rive::Font> InFont)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("URiveFile::FinishAssetLoad"),
+                                STAT_URiveFile_FinishAssetLoad,
+                                STATGROUP_Rive);
+
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    rive::FileAsset* NativeAsset =
+        InAsset->NativeAsset ? InAsset->NativeAsset->as<rive::FileAsset>()
+                             : nullptr;
+    const bool bLoaded =
+        RiveRenderer != nullptr && NativeAsset != nullptr &&
+        ((InImage != nullptr && NativeAsset->is<rive::ImageAsset>()) ||
+         (InFont != nullptr && NativeAsset->is<rive::FontAsset>()));
+    if (!bLoaded)
+    {
+        // Left to be retried by the next artboard or prefetch that needs it
+        InAsset->OnDemandLoadState = ERiveOnDemandLoadState::Pending;
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Could not load asset '%s' of rive file '%s' on demand"),
+               *InAsset->Name,
+               *GetName());
+        return;
+    }
+
+    {
+        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+        if (InImage != nullptr)
+        {
+            NativeAsset->as<rive::ImageAsset>()->renderImage(InImage);
+        }
+        else
+        {
+            NativeAsset->as<rive::FontAsset>()->font(InFont);
+        }
+    }
+    InAsset->OnDemandLoadState = ERiveOnDemandLoadState::None;
+
+    UE_LOG(LogRive,
+           Verbose,
+           TEXT("Loaded asset '%s' of rive file '%s' on demand"),
+           *InAsset->Name,
+           *GetName());
+}
+
+#endif // WITH_RIVE
+
+void URiveFile::PrefetchAssets(const TArray<FString>& InArtboardNames,
+                               ERiveAssetLoadPriority InPriority)
+{
+#if WITH_RIVE
+    if (!IsInitialized())
+    {
+        OnInitializedOnceDelegate.AddWeakLambda(
+            this,
+            [this, InArtboardNames, InPriority](bool bSuccess) {
+                if (bSuccess)
+                {
+                    PrefetchAssets(InArtboardNames, InPriority);
                 }
+            });
+        return;
+    }
 
-                UE_LOG(LogRive, Error, TEXT("Failed to import rive file."));
-                BroadcastInitializationResult(false);
-            }));
+    TArray<URiveAsset*> OnDemandAssets;
+    FindOnDemandAssets(InArtboardNames, OnDemandAssets);
+    for (URiveAsset* Asset : OnDemandAssets)
+    {
+        LoadAssetOnDemand(Asset, InPriority);
+    }
+#endif // WITH_RIVE
+}
+
+bool URiveFile::AreAssetsLoaded(const TArray<FString>& InArtboardNames) const
+{
+#if WITH_RIVE
+    if (!IsInitialized())
+    {
+        return false;
+    }
+
+    TArray<URiveAsset*> OnDemandAssets;
+    FindOnDemandAssets(InArtboardNames, OnDemandAssets);
+    return OnDemandAssets.IsEmpty();
+#else
+    return false;
 #endif // WITH_RIVE
 }
 
+void URiveFile::ReleaseImportBytes()
+{
+    INC_MEMORY_STAT_BY(STAT_RiveFileDataReleased,
+                       ImportBytes.Num() + CookedImagePixels.Num());
+    RiveNativeFileSpan = {};
+    ImportBytes.Empty();
+    CookedImagePixels.Empty();
+}
+
 void URiveFile::BroadcastInitializationResult(bool bSuccess)
 {
+    ReleaseImportBytes();
+
     WasLastInitializationSuccessful = bSuccess;
     InitState =
         bSuccess ? ERiveInitState::Initialized : ERiveInitState::Uninitialized;
@@ -220,6 +842,27 @@ void URiveFile::BroadcastInitializationResult(bool bSuccess)
     }
 }
 
+const FRiveArtboardMetadata* URiveFile::FindArtboardMetadata(
+    const FString& InArtboardName) const
+{
+    return ArtboardMetadata.FindByPredicate(
+        [&InArtboardName](const FRiveArtboardMetadata& Metadata) {
+            return Metadata.Name.Equals(InArtboardName);
+        });
+}
+
+TArray<FString> URiveFile::GetStateMachineNamesForDropdown(
+    const FString& InArtboardName) const
+{
+    TArray<FString> Output{""};
+    if (const FRiveArtboardMetadata* Metadata =
+            FindArtboardMetadata(InArtboardName))
+    {
+        Output.Append(Metadata->GetStateMachineNames());
+    }
+    return Output;
+}
+
 int32 URiveFile::GetViewModelCount() const
 {
     if (!RiveNativeFilePtr)
@@ -290,6 +933,16 @@ URiveViewModel* URiveFile::GetDefaultArtboardViewModel(
     return nullptr;
 }
 
+void URiveFile::SetRiveFileData(const TArray<uint8>& InRiveFileBuffer)
+{
+    // Initialize only imports files again when they are editor reimports
+    ensureMsgf(InitState == ERiveInitState::Uninitialized,
+               TEXT("Setting the data of the Rive File '%s' after it was "
+                    "initialized has no effect"),
+               *GetName());
+    RiveAssetHelpers::SetBulkData(RiveFileBulkData, InRiveFileBuffer);
+}
+
 #if WITH_EDITOR
 void URiveFile::PrintStats() const
 {
@@ -366,7 +1019,8 @@ bool URiveFile::EditorImport(const FString& InRiveFilePath,
 
 #endif
 
-    RiveFileData = MoveTemp(InRiveFileBuffer);
+    RiveAssetHelpers::SetBulkData(RiveFileBulkData, InRiveFileBuffer);
+    InRiveFileBuffer.Empty();
     if (bIsReimport)
     {
         Initialize();
@@ -0,0 +1,104 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveLoadFileAsyncAction.h"
+
+#include "Logs/RiveLog.h"
+#include "Rive/RiveFile.h"
+#include "UObject/Package.h"
+
+URiveLoadFileAsyncAction* URiveLoadFileAsyncAction::LoadRiveFileAsync(
+    UObject* WorldContextObject,
+    TSoftObjectPtr<URiveFile> RiveFile)
+{
+    URiveLoadFileAsyncAction* Action = NewObject<URiveLoadFileAsyncAction>();
+    Action->SoftRiveFile = RiveFile;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void URiveLoadFileAsyncAction::Activate()
+{
+    if (SoftRiveFile.IsNull())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Load Rive File Async was called without a RiveFile."));
+        Finish(false);
+        return;
+    }
+
+    if (URiveFile* LoadedFile = SoftRiveFile.Get())
+    {
+        RiveFile = LoadedFile;
+        WaitForInitialization();
+        return;
+    }
+
+    LoadPackageAsync(
+        SoftRiveFile.ToSoftObjectPath().GetLongPackageName(),
+        FLoadPackageAsyncDelegate::CreateUObject(
+            this,
+            &URiveLoadFileAsyncAction::OnPackageLoaded));
+}
+
+void URiveLoadFileAsyncAction::OnPackageLoaded(
+    const FName& InPackageName,
+    UPackage* InPackage,
+    EAsyncLoadingResult::Type InResult)
+{
+    RiveFile = SoftRiveFile.Get();
+    if (InResult != EAsyncLoadingResult::Succeeded || RiveFile == nullptr)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Load Rive File Async could not load '%s'."),
+               *SoftRiveFile.ToString());
+        Finish(false);
+        return;
+    }
+
+    WaitForInitialization();
+}
+
+void URiveLoadFileAsyncAction::WaitForInitialization()
+{
+    if (RiveFile->IsInitialized())
+    {
+        Finish(true);
+        return;
+    }
+
+    RiveFile->OnInitializedDelegate.AddUObject(
+        this,
+        &URiveLoadFileAsyncAction::OnFileInitialized);
+
+    // Retries files whose last import failed. Files still waiting on the
+    // renderer just register for it again, Initialize ignores the second call.
+    if (RiveFile->InitializationState() == ERiveInitState::Uninitialized)
+    {
+        RiveFile->Initialize();
+    }
+}
+
+void URiveLoadFileAsyncAction::OnFileInitialized(bool bInSuccess)
+{
+    Finish(bInSuccess);
+}
+
+void URiveLoadFileAsyncAction::Finish(bool bInSuccess)
+{
+    if (RiveFile)
+    {
+        RiveFile->OnInitializedDelegate.RemoveAll(this);
+    }
+
+    if (bInSuccess)
+    {
+        OnLoaded.Broadcast(RiveFile);
+    }
+    else
+    {
+        OnFailed.Broadcast(RiveFile);
+    }
+    SetReadyToDestroy();
+}
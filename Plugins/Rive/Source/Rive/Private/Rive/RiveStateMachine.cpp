@@ -4,10 +4,9 @@
 #include "Rive/ViewModel/RiveViewModelInstance.h"
 #include "rive/viewmodel/runtime/viewmodel_instance_runtime.hpp"
 
-#include "IRiveRenderer.h"
-#include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
-#include "Stats/RiveStats.h"
+#include "RiveScopeLock.h"
+#include "RiveStats.h"
 
 #if WITH_RIVE
 THIRD_PARTY_INCLUDES_START
@@ -25,13 +24,11 @@ rive::EventReport FRiveStateMachine::NullEvent =
 
 FRiveStateMachine::FRiveStateMachine(
     rive::ArtboardInstance* InNativeArtboardInst,
-    const FString& InStateMachineName)
+    const FString& InStateMachineName,
+    const TSharedRef<FCriticalSection>& InArtboardCS) :
+    ArtboardCS(InArtboardCS)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        RiveRenderer->GetThreadDataCS().Lock();
-    }
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (InStateMachineName.IsEmpty())
     {
@@ -82,11 +79,6 @@ FRiveStateMachine::FRiveStateMachine(
             }
         }
     }
-
-    if (RiveRenderer)
-    {
-        RiveRenderer->GetThreadDataCS().Unlock();
-    }
 }
 
 bool FRiveStateMachine::Advance(float InSeconds)
@@ -95,39 +87,33 @@ bool FRiveStateMachine::Advance(float InSeconds)
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRiveStateMachine::Advance"),
                                 STAT_STATEMACHINE_ADVANCE,
                                 STATGROUP_Rive);
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to Advance the StateMachine as we do not have a "
-                    "valid renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (NativeStateMachinePtr)
     {
-        return NativeStateMachinePtr->advanceAndApply(InSeconds);
+        const bool bKeepGoing =
+            NativeStateMachinePtr->advanceAndApply(InSeconds);
+
+        // The advance that settles still applies a new pose, only the ones
+        // after it leave the artboard untouched
+        bIsSettled = !bKeepGoing && !bKeptGoing && !bHasPendingChanges;
+        bKeptGoing = bKeepGoing;
+        bHasPendingChanges = false;
+        return bKeepGoing;
     }
 
     return false;
 }
 
-uint32 FRiveStateMachine::GetInputCount() const
+bool FRiveStateMachine::IsSettled() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetInputCount on the StateMachine as we do not "
-                    "have a valid renderer."));
-        return 0;
-    }
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+    return bIsSettled;
+}
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+uint32 FRiveStateMachine::GetInputCount() const
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (NativeStateMachinePtr)
     {
@@ -139,17 +125,7 @@ uint32 FRiveStateMachine::GetInputCount() const
 
 rive::SMIInput* FRiveStateMachine::GetInput(uint32 AtIndex) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetInput on the StateMachine as we do not have "
-                    "a valid renderer."));
-        return nullptr;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (NativeStateMachinePtr)
     {
@@ -161,8 +137,7 @@ rive::SMIInput* FRiveStateMachine::GetInput(uint32 AtIndex) const
 
 void FRiveStateMachine::FireTrigger(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -173,6 +148,7 @@ void FRiveStateMachine::FireTrigger(const FString& InPropertyName) const
             NativeStateMachinePtr->getTrigger(TCHAR_TO_UTF8(*InPropertyName)))
     {
         TriggerToBeFired->fire();
+        bHasPendingChanges = true;
         return;
     }
 
@@ -185,17 +161,7 @@ void FRiveStateMachine::FireTrigger(const FString& InPropertyName) const
 
 bool FRiveStateMachine::GetBoolValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetBoolValue on the StateMachine as we do not "
-                    "have a valid renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -218,17 +184,7 @@ bool FRiveStateMachine::GetBoolValue(const FString& InPropertyName) const
 
 float FRiveStateMachine::GetNumberValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetNumberValue on the StateMachine as we "
-                    "do not have a valid renderer."));
-        return 0.f;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -252,17 +208,7 @@ float FRiveStateMachine::GetNumberValue(const FString& InPropertyName) const
 void FRiveStateMachine::SetBoolValue(const FString& InPropertyName,
                                      bool bNewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to SetBoolValue on the StateMachine as we do not "
-                    "have a valid renderer."));
-        return;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -273,6 +219,7 @@ void FRiveStateMachine::SetBoolValue(const FString& InPropertyName,
             NativeStateMachinePtr->getBool(TCHAR_TO_UTF8(*InPropertyName)))
     {
         BoolProperty->value(bNewValue);
+        bHasPendingChanges = true;
         return;
     }
 
@@ -286,17 +233,7 @@ void FRiveStateMachine::SetBoolValue(const FString& InPropertyName,
 void FRiveStateMachine::SetNumberValue(const FString& InPropertyName,
                                        float NewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to SetNumberValue on the StateMachine "
-                    "as we do not have a valid renderer."));
-        return;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -307,6 +244,7 @@ void FRiveStateMachine::SetNumberValue(const FString& InPropertyName,
             NativeStateMachinePtr->getNumber(TCHAR_TO_UTF8(*InPropertyName)))
     {
         NumberProperty->value(NewValue);
+        bHasPendingChanges = true;
         return;
     }
 
@@ -317,26 +255,87 @@ void FRiveStateMachine::SetNumberValue(const FString& InPropertyName,
            *InPropertyName);
 }
 
-bool FRiveStateMachine::PointerDown(const FVector2f& NewPosition)
+int32 FRiveStateMachine::SetInputValues(
+    TConstArrayView<FRiveInputValue> InValues,
+    TArray<int32>& OutFailedIndices)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
+    SCOPED_NAMED_EVENT_TEXT(TEXT("FRiveStateMachine::SetInputValues"),
+                            FColor::White);
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+
+    int32 AppliedCount = 0;
+    for (int32 Index = 0; Index < InValues.Num(); ++Index)
+    {
+        const FRiveInputValue& Value = InValues[Index];
+        if (Value.Path.IsEmpty() &&
+            ApplyInputValue(Value, TCHAR_TO_UTF8(*Value.Name)))
+        {
+            ++AppliedCount;
+        }
+        else
+        {
+            OutFailedIndices.Add(Index);
+        }
+    }
+
+    return AppliedCount;
+}
+
+bool FRiveStateMachine::ApplyInputValue(const FRiveInputValue& InValue,
+                                        const char* InName)
+{
+    if (!NativeStateMachinePtr)
     {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to call PointerDown on the StateMachine as we do "
-                    "not have a valid "
-                    "renderer."));
         return false;
     }
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    switch (InValue.Type)
+    {
+        case ERiveInputValueType::Bool:
+            if (rive::SMIBool* BoolProperty =
+                    NativeStateMachinePtr->getBool(InName))
+            {
+                BoolProperty->value(InValue.bBoolValue);
+                bHasPendingChanges = true;
+                return true;
+            }
+            break;
+        case ERiveInputValueType::Number:
+            if (rive::SMINumber* NumberProperty =
+                    NativeStateMachinePtr->getNumber(InName))
+            {
+                NumberProperty->value(InValue.NumberValue);
+                bHasPendingChanges = true;
+                return true;
+            }
+            break;
+        case ERiveInputValueType::Trigger:
+            if (rive::SMITrigger* TriggerProperty =
+                    NativeStateMachinePtr->getTrigger(InName))
+            {
+                TriggerProperty->fire();
+                bHasPendingChanges = true;
+                return true;
+            }
+            break;
+        case ERiveInputValueType::Text:
+            // Text runs belong to the artboard, see URiveArtboard
+            break;
+    }
+
+    return false;
+}
+
+bool FRiveStateMachine::PointerDown(const FVector2f& NewPosition)
+{
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
         return false;
     }
 
+    bHasPendingChanges = true;
     rive::HitResult HitResult =
         NativeStateMachinePtr->pointerDown({NewPosition.X, NewPosition.Y});
     return HitResult != rive::HitResult::none;
@@ -344,24 +343,14 @@ bool FRiveStateMachine::PointerDown(const FVector2f& NewPosition)
 
 bool FRiveStateMachine::PointerMove(const FVector2f& NewPosition)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to call PointerMove on the StateMachine as we do "
-                    "not have a valid "
-                    "renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
         return false;
     }
 
+    bHasPendingChanges = true;
     rive::HitResult HitResult =
         NativeStateMachinePtr->pointerMove({NewPosition.X, NewPosition.Y});
     return HitResult != rive::HitResult::none;
@@ -369,23 +358,14 @@ bool FRiveStateMachine::PointerMove(const FVector2f& NewPosition)
 
 bool FRiveStateMachine::PointerUp(const FVector2f& NewPosition)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to call PointerUp on the StateMachine as we do "
-                    "not have a valid renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
         return false;
     }
 
+    bHasPendingChanges = true;
     rive::HitResult HitResult =
         NativeStateMachinePtr->pointerUp({NewPosition.X, NewPosition.Y});
     return HitResult != rive::HitResult::none;
@@ -393,23 +373,14 @@ bool FRiveStateMachine::PointerUp(const FVector2f& NewPosition)
 
 bool FRiveStateMachine::PointerExit(const FVector2f& NewPosition)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to call PointerExit on the StateMachine as we do "
-                    "not have a valid renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
         return false;
     }
 
+    bHasPendingChanges = true;
     rive::HitResult HitResult =
         NativeStateMachinePtr->pointerExit({NewPosition.X, NewPosition.Y});
     return HitResult != rive::HitResult::none;
@@ -417,17 +388,7 @@ bool FRiveStateMachine::PointerExit(const FVector2f& NewPosition)
 
 const rive::EventReport FRiveStateMachine::GetReportedEvent(int32 AtIndex) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetReportedEvent on the StateMachine as we do "
-                    "not have a valid renderer."));
-        return NullEvent;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr || !HasAnyReportedEvents())
     {
@@ -439,17 +400,7 @@ const rive::EventReport FRiveStateMachine::GetReportedEvent(int32 AtIndex) const
 
 int32 FRiveStateMachine::GetReportedEventsCount() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetReportedEventsCount on the StateMachine as "
-                    "we do not have a valid renderer."));
-        return 0;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr || !HasAnyReportedEvents())
     {
@@ -461,17 +412,7 @@ int32 FRiveStateMachine::GetReportedEventsCount() const
 
 bool FRiveStateMachine::HasAnyReportedEvents() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to HasAnyReportedEvents on the StateMachine as we "
-                    "do not have a valid renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FRiveScopeLock Lock(&ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -484,6 +425,8 @@ bool FRiveStateMachine::HasAnyReportedEvents() const
 void FRiveStateMachine::SetViewModelInstance(
     URiveViewModelInstance* RiveViewModelInstance)
 {
+    FRiveScopeLock Lock(&ArtboardCS.Get());
+
     if (!NativeStateMachinePtr)
     {
         UE_LOG(LogRive,
@@ -508,6 +451,7 @@ void FRiveStateMachine::SetViewModelInstance(
 
     // Set the data context on the native Rive state machine
     NativeStateMachinePtr->bindViewModelInstance(NativeInstance->instance());
+    bHasPendingChanges = true;
 }
 
 #endif // WITH_RIVE
@@ -2,13 +2,23 @@
 
 #include "Rive/RiveTexture.h"
 
+#include "HAL/IConsoleManager.h"
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
 #include "RenderingThread.h"
 #include "Rive/RiveArtboard.h"
+#include "Rive/RiveTexturePool.h"
 #include "Rive/RiveTextureResource.h"
 
+static TAutoConsoleVariable<float> CVarRiveResizeDelay(
+    TEXT("r.rive.resizedelay"),
+    0.1f,
+    TEXT("Seconds a rive texture waits after the last resize request before "
+         "recreating its render target, so dragging a widget or viewport "
+         "edge does not recreate it every frame. 0 resizes immediately."),
+    ECVF_Default);
+
 URiveTexture::URiveTexture()
 {
     SRGB = true;
@@ -34,8 +44,6 @@ FTextureResource* URiveTexture::CreateResource()
         return nullptr;
     }
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
     // UTexture::ReleaseResource() calls the delete
     CurrentResource = new FRiveTextureResource(this);
     SetResource(CurrentResource);
@@ -54,6 +62,18 @@ void URiveTexture::PostLoad()
     }
 }
 
+void URiveTexture::BeginDestroy()
+{
+    if (ResizeTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(ResizeTickerHandle);
+        ResizeTickerHandle.Reset();
+    }
+    PendingSize.Reset();
+
+    Super::BeginDestroy();
+}
+
 void URiveTexture::ResizeRenderTargets(FIntPoint InNewSize)
 {
     if (InNewSize.X < RIVE_MIN_TEX_RESOLUTION ||
@@ -72,31 +92,31 @@ void URiveTexture::ResizeRenderTargets(FIntPoint InNewSize)
 
     if (CurrentResource && InNewSize.X == Size.X && InNewSize.Y == Size.Y)
     {
+        // Back to the current size before the pending one was applied
+        PendingSize.Reset();
+
         // Just making sure all internal data lines up
         SizeX = Size.X;
         SizeY = Size.Y;
         return;
     }
 
-    // we need to make sure we are not drawing anything with the old size,
-    // so we ensure all the commands are sent before going further
-    FlushRenderingCommands();
-
-    SizeX = Size.X = InNewSize.X;
-    SizeY = Size.Y = InNewSize.Y;
-
-    if (!CurrentResource)
+    const float ResizeDelay = CVarRiveResizeDelay.GetValueOnGameThread();
+    if (!CurrentResource || ResizeDelay <= 0.f)
     {
-        // Create Resource
-        UpdateResource();
+        PendingSize.Reset();
+        ApplySize(InNewSize);
+        return;
     }
-    else
+
+    PendingSize = InNewSize;
+    PendingSizeTime = FPlatformTime::Seconds();
+    if (!ResizeTickerHandle.IsValid())
     {
-        // Create new TextureRHI with new size
-        InitializeResources();
+        ResizeTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this,
+                                           &URiveTexture::TickPendingResize));
     }
-
-    FlushRenderingCommands();
 }
 
 void URiveTexture::ResizeRenderTargets(const FVector2f InNewSize)
@@ -130,6 +150,44 @@ FVector2f URiveTexture::GetLocalCoordinatesFromExtents(
     }
 }
 
+void URiveTexture::ApplySize(const FIntPoint& InNewSize)
+{
+    // Draws recorded from now on use the new size, and the render thread
+    // swaps the texture in order with them, so nothing needs to be flushed
+    SizeX = Size.X = InNewSize.X;
+    SizeY = Size.Y = InNewSize.Y;
+
+    if (!CurrentResource)
+    {
+        // Create Resource
+        UpdateResource();
+    }
+    else
+    {
+        // Create new TextureRHI with new size
+        InitializeResources();
+    }
+}
+
+bool URiveTexture::TickPendingResize(float InDeltaTime)
+{
+    if (PendingSize.IsSet())
+    {
+        const double Elapsed = FPlatformTime::Seconds() - PendingSizeTime;
+        if (Elapsed < CVarRiveResizeDelay.GetValueOnGameThread())
+        {
+            return true;
+        }
+
+        const FIntPoint NewSize = PendingSize.GetValue();
+        PendingSize.Reset();
+        ApplySize(NewSize);
+    }
+
+    ResizeTickerHandle.Reset();
+    return false;
+}
+
 void URiveTexture::InitializeResources() const
 {
     if (!IRiveRendererModule::Get().GetRenderer())
@@ -142,30 +200,42 @@ void URiveTexture::InitializeResources() const
         return;
     }
 
+    // Captured by value, the game thread may resize again before this runs
     ENQUEUE_RENDER_COMMAND(FRiveTextureResourceeUpdateTextureReference)
-    ([this](FRHICommandListImmediate& RHICmdList) {
+    ([this,
+      TextureSize = Size,
+      TextureFormat = Format,
+      bSRGB = SRGB,
+      DebugName = GetName(),
+      TextureName = GetFName()](FRHICommandListImmediate& RHICmdList) {
         IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
         FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
 
         FTextureRHIRef RenderableTexture;
-        const FString DebugName = GetName();
 
         FRHITextureCreateDesc RenderTargetTextureDesc =
-            FRHITextureCreateDesc::Create2D(*DebugName, Size.X, Size.Y, Format)
+            FRHITextureCreateDesc::Create2D(*DebugName,
+                                            TextureSize.X,
+                                            TextureSize.Y,
+                                            TextureFormat)
                 .SetFlags(ETextureCreateFlags::UAV |
                           ETextureCreateFlags::Dynamic |
                           ETextureCreateFlags::ShaderResource |
                           ETextureCreateFlags::RenderTargetable);
 
 #if !(PLATFORM_IOS || PLATFORM_MAC) // SRGB could have been manually overriden
-        if (SRGB)
+        if (bSRGB)
         {
             RenderTargetTextureDesc.AddFlags(ETextureCreateFlags::SRGB);
         }
 #endif
 
-        RenderableTexture = RHICreateTexture(RenderTargetTextureDesc);
-        RenderableTexture->SetName(GetFName());
+        // Same size textures released by resized or destroyed rive textures
+        // are reused instead of allocating a new one
+        RenderableTexture =
+            FRiveTexturePool::Get().FindOrCreate(RenderTargetTextureDesc);
+        RenderableTexture->SetName(TextureName);
+        FRiveTexturePool::Get().Release(CurrentResource->TextureRHI);
         CurrentResource->TextureRHI = RenderableTexture;
 
         RHIUpdateTextureReference(TextureReference.TextureReferenceRHI,
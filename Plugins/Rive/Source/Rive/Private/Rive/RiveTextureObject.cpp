@@ -91,7 +91,7 @@ void URiveTextureObject::Tick(float InDeltaSeconds)
         if (GetArtboard())
         {
             Artboard->Tick(InDeltaSeconds);
-            RiveRenderTarget->SubmitAndClear();
+            RiveRenderTarget->SubmitAndClearIfChanged(Artboard->NeedsRedraw());
         }
     }
 #endif // WITH_RIVE
@@ -243,6 +243,7 @@ void URiveTextureObject::OnRiveFileInitialized(bool bSuccess)
 
         RiveRenderTarget->SetClearColor(ClearColor);
 
+        Artboard->AssetLoadPriority = RiveDescriptor.AssetLoadPriority;
         if (RiveDescriptor.ArtboardName.IsEmpty())
         {
             Artboard->Initialize(RiveDescriptor.RiveFile,
@@ -339,36 +340,21 @@ void URiveTextureObject::OnArtboardTickRender(float DeltaTime,
 
 TArray<FString> URiveTextureObject::GetArtboardNamesForDropdown() const
 {
-    TArray<FString> Output;
     if (RiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* DescriptorArtboard :
-             RiveDescriptor.RiveFile->Artboards)
-        {
-            Output.Add(DescriptorArtboard->GetArtboardName());
-        }
+        return RiveDescriptor.RiveFile->GetArtboardNamesForDropdown();
     }
-
-    return Output;
+    return {};
 }
 
 TArray<FString> URiveTextureObject::GetStateMachineNamesForDropdown() const
 {
-    TArray<FString> Output{""};
     if (RiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* RiveFileArtboard :
-             RiveDescriptor.RiveFile->Artboards)
-        {
-            if (RiveFileArtboard->GetArtboardName().Equals(
-                    RiveDescriptor.ArtboardName))
-            {
-                Output.Append(RiveFileArtboard->GetStateMachineNames());
-                break;
-            }
-        }
+        return RiveDescriptor.RiveFile->GetStateMachineNamesForDropdown(
+            RiveDescriptor.ArtboardName);
     }
-    return Output;
+    return {""};
 }
 
 void URiveTextureObject::InitializeAudioEngine()
@@ -0,0 +1,98 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveTexturePool.h"
+
+#include "HAL/IConsoleManager.h"
+#include "RenderUtils.h"
+#include "RHICommandList.h"
+#include "RiveStats.h"
+
+static TAutoConsoleVariable<int32> CVarRiveTexturePoolMaxMB(
+    TEXT("r.rive.texturepoolsize"),
+    64,
+    TEXT("Memory, in MB, the render targets released by rive textures can "
+         "keep so a later texture of the same size reuses them. 0 disables "
+         "the pool."),
+    ECVF_Default);
+
+FRiveTexturePool& FRiveTexturePool::Get()
+{
+    static FRiveTexturePool TexturePool;
+    return TexturePool;
+}
+
+void FRiveTexturePool::Shutdown()
+{
+    FScopeLock Lock(&TexturesCS);
+    Trim(0);
+}
+
+FTextureRHIRef FRiveTexturePool::FindOrCreate(
+    const FRHITextureCreateDesc& InDesc)
+{
+    {
+        FScopeLock Lock(&TexturesCS);
+        // Most recently released first, it is the likeliest to be reused
+        for (int32 Index = Textures.Num() - 1; Index >= 0; --Index)
+        {
+            const FRHITextureDesc& Desc = Textures[Index]->GetDesc();
+            if (Desc.Extent == InDesc.Extent && Desc.Format == InDesc.Format &&
+                Desc.Flags == InDesc.Flags && Desc.NumMips == InDesc.NumMips)
+            {
+                FTextureRHIRef Texture = Textures[Index];
+                Textures.RemoveAt(Index);
+                SizeInBytes -= GetSizeInBytes(*Texture);
+                SET_MEMORY_STAT(STAT_RiveTexturePoolMemory, SizeInBytes);
+                INC_DWORD_STAT(STAT_RiveTexturePoolHits);
+                return Texture;
+            }
+        }
+    }
+
+    INC_DWORD_STAT(STAT_RiveTexturePoolMisses);
+    return RHICreateTexture(InDesc);
+}
+
+void FRiveTexturePool::Release(const FTextureRHIRef& InTexture)
+{
+    if (!InTexture.IsValid())
+    {
+        return;
+    }
+
+    const int64 MaxSizeInBytes =
+        static_cast<int64>(CVarRiveTexturePoolMaxMB.GetValueOnAnyThread()) *
+        1024 * 1024;
+    const int64 TextureSizeInBytes = GetSizeInBytes(*InTexture);
+    if (TextureSizeInBytes > MaxSizeInBytes)
+    {
+        return;
+    }
+
+    FScopeLock Lock(&TexturesCS);
+    Trim(MaxSizeInBytes - TextureSizeInBytes);
+    Textures.Add(InTexture);
+    SizeInBytes += TextureSizeInBytes;
+    SET_MEMORY_STAT(STAT_RiveTexturePoolMemory, SizeInBytes);
+}
+
+void FRiveTexturePool::Trim(int64 InMaxSizeInBytes)
+{
+    int32 NumRemoved = 0;
+    while (NumRemoved < Textures.Num() && SizeInBytes > InMaxSizeInBytes)
+    {
+        SizeInBytes -= GetSizeInBytes(*Textures[NumRemoved]);
+        ++NumRemoved;
+    }
+    Textures.RemoveAt(0, NumRemoved);
+    SET_MEMORY_STAT(STAT_RiveTexturePoolMemory, SizeInBytes);
+}
+
+int64 FRiveTexturePool::GetSizeInBytes(const FRHITexture& InTexture)
+{
+    const FRHITextureDesc& Desc = InTexture.GetDesc();
+    return CalcTextureSize(Desc.Extent.X,
+                           Desc.Extent.Y,
+                           Desc.Format,
+                           Desc.NumMips);
+}
@@ -0,0 +1,52 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHIResources.h"
+
+/**
+ * Render targets of URiveTextures that were resized or released, kept so a
+ * texture of the same size, format and flags can be reused instead of
+ * allocating GPU memory again. The least recently released ones are dropped
+ * once the pool is over r.rive.texturepoolsize.
+ */
+class FRiveTexturePool
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    static FRiveTexturePool& Get();
+
+    void Shutdown();
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /** Returns a pooled texture matching InDesc, or a new one */
+    FTextureRHIRef FindOrCreate(const FRHITextureCreateDesc& InDesc);
+
+    /** Hands InTexture back to the pool, it must not be used afterwards */
+    void Release(const FTextureRHIRef& InTexture);
+
+private:
+    /** Called with TexturesCS held */
+    void Trim(int64 InMaxSizeInBytes);
+
+    static int64 GetSizeInBytes(const FRHITexture& InTexture);
+
+    /**
+     * Attribute(s)
+     */
+
+    FCriticalSection TexturesCS;
+
+    /** Least recently released first */
+    TArray<FTextureRHIRef> Textures;
+
+    int64 SizeInBytes = 0;
+};
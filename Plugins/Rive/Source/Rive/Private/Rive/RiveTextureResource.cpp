@@ -9,6 +9,7 @@
 #include "Logs/RiveLog.h"
 #include "RenderUtils.h"
 #include "Rive/RiveTexture.h"
+#include "Rive/RiveTexturePool.h"
 
 FRiveTextureResource::FRiveTextureResource(URiveTexture* Owner) :
     RiveTexture(Owner)
@@ -60,6 +61,7 @@ void FRiveTextureResource::ReleaseRHI()
             nullptr);
     }
 
+    FRiveTexturePool::Get().Release(TextureRHI);
     FTextureResource::ReleaseRHI();
 
     if (RiveRenderer)
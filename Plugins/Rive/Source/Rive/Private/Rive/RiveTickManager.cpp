@@ -0,0 +1,181 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveTickManager.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveStateMachine.h"
+#include "Rive/ViewModel/RiveViewModelInstance.h"
+#include "RiveStats.h"
+
+static TAutoConsoleVariable<bool> CVarRiveParallelAdvance(
+    TEXT("r.rive.paralleladvance"),
+    true,
+    TEXT("If true, the state machines of all ticking artboards are advanced "
+         "in parallel at the start of the frame instead of one by one from "
+         "their owner's tick."));
+
+static TAutoConsoleVariable<int32> CVarRiveParallelAdvanceMinBatch(
+    TEXT("r.rive.paralleladvance.minbatch"),
+    4,
+    TEXT("Below this number of artboards, the state machines are advanced on "
+         "the game thread."));
+
+FRiveTickManager& FRiveTickManager::Get()
+{
+    static FRiveTickManager TickManager;
+    return TickManager;
+}
+
+void FRiveTickManager::Startup()
+{
+    OnWorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddRaw(
+        this,
+        &FRiveTickManager::OnWorldTickStart);
+}
+
+void FRiveTickManager::Shutdown()
+{
+    FWorldDelegates::OnWorldTickStart.Remove(OnWorldTickStartHandle);
+    OnWorldTickStartHandle.Reset();
+    Artboards.Empty();
+}
+
+void FRiveTickManager::Register(URiveArtboard* InArtboard)
+{
+    check(IsInGameThread());
+    Artboards.AddUnique(InArtboard);
+}
+
+void FRiveTickManager::Unregister(URiveArtboard* InArtboard)
+{
+    check(IsInGameThread());
+    Artboards.Remove(InArtboard);
+}
+
+void FRiveTickManager::OnWorldTickStart(UWorld* InWorld,
+                                        ELevelTick InTickType,
+                                        float InDeltaSeconds)
+{
+    if (InTickType == LEVELTICK_PauseTick || InWorld->IsPaused() ||
+        !CVarRiveParallelAdvance.GetValueOnGameThread())
+    {
+        return;
+    }
+
+    // UWorld::Tick only dilates its delta after this broadcast
+    float DeltaSeconds = InDeltaSeconds;
+    if (AWorldSettings* WorldSettings = InWorld->GetWorldSettings())
+    {
+        DeltaSeconds = WorldSettings->FixupDeltaSeconds(
+            InDeltaSeconds * WorldSettings->GetEffectiveTimeDilation(),
+            InDeltaSeconds);
+    }
+    AdvanceArtboards(*InWorld, DeltaSeconds);
+}
+
+void FRiveTickManager::AdvanceArtboards(const UWorld& InWorld,
+                                        float InDeltaSeconds)
+{
+#if WITH_RIVE
+    SCOPED_NAMED_EVENT_TEXT("FRiveTickManager::AdvanceArtboards",
+                            FColor::White);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRiveTickManager::AdvanceArtboards"),
+                                STAT_RIVETICKMANAGER_ADVANCE,
+                                STATGROUP_Rive);
+
+    Artboards.RemoveAll([](const TWeakObjectPtr<URiveArtboard>& Artboard) {
+        return !Artboard.IsValid();
+    });
+
+    // The world's delta still is the one of the previous frame, owners ticked
+    // with another one have a tick interval or their own time dilation
+    const float LastWorldDeltaSeconds = InWorld.GetDeltaSeconds();
+    TArray<URiveArtboard*, TInlineAllocator<64>> Candidates;
+    for (const TWeakObjectPtr<URiveArtboard>& WeakArtboard : Artboards)
+    {
+        URiveArtboard* Artboard = WeakArtboard.Get();
+        if (!Artboard->bIsInitialized || !Artboard->RiveRenderTarget ||
+            Artboard->bIsReceivingInput ||
+            Artboard->OnArtboardTick_StateMachine.IsBound() ||
+            Artboard->LastTickFrame + 1 != GFrameCounter ||
+            Artboard->LastAdvanceFrame == GFrameCounter ||
+            Artboard->GetWorld() != &InWorld ||
+            !FMath::IsNearlyEqual(Artboard->LastTickDeltaSeconds,
+                                  LastWorldDeltaSeconds))
+        {
+            continue;
+        }
+        Candidates.Add(Artboard);
+    }
+
+    // Events reported by the previous advance are broadcast before advancing
+    // again, same as URiveArtboard::AdvanceStateMachine. Their handlers may
+    // (de)initialize artboards, which changes Artboards, so they only run once
+    // it is no longer iterated.
+    for (URiveArtboard* Artboard : Candidates)
+    {
+        FRiveStateMachine* StateMachine = Artboard->GetStateMachine();
+        if (StateMachine && StateMachine->HasAnyReportedEvents())
+        {
+            Artboard->PopulateReportedEvents();
+        }
+    }
+
+    // Artboards sharing a ViewModel instance can not be advanced at the same
+    // time, so the ones with a ViewModel stay on the game thread
+    TArray<URiveArtboard*, TInlineAllocator<64>> Batch;
+    TArray<URiveArtboard*, TInlineAllocator<64>> GameThreadBatch;
+    for (URiveArtboard* Artboard : Candidates)
+    {
+        // A reported event may have deinitialized the artboard since
+        FRiveStateMachine* StateMachine = Artboard->GetStateMachine();
+        if (!Artboard->bIsInitialized || !StateMachine ||
+            !StateMachine->IsValid())
+        {
+            continue;
+        }
+
+        Artboard->LastAdvanceFrame = GFrameCounter;
+        if (Artboard->CurrentViewModelInstance.IsValid())
+        {
+            GameThreadBatch.Add(Artboard);
+        }
+        else
+        {
+            Batch.Add(Artboard);
+        }
+    }
+
+    const EParallelForFlags Flags =
+        Batch.Num() < CVarRiveParallelAdvanceMinBatch.GetValueOnGameThread()
+            ? EParallelForFlags::ForceSingleThread
+            : EParallelForFlags::None;
+    ParallelFor(
+        Batch.Num(),
+        [&Batch, InDeltaSeconds](int32 Index) {
+            if (FRiveStateMachine* StateMachine =
+                    Batch[Index]->GetStateMachine())
+            {
+                Batch[Index]->Advance_Internal(*StateMachine, InDeltaSeconds);
+            }
+        },
+        Flags);
+
+    for (URiveArtboard* Artboard : GameThreadBatch)
+    {
+        if (FRiveStateMachine* StateMachine = Artboard->GetStateMachine())
+        {
+            Artboard->Advance_Internal(*StateMachine, InDeltaSeconds);
+        }
+
+        if (Artboard->CurrentViewModelInstance.IsValid())
+        {
+            Artboard->CurrentViewModelInstance->HandleCallbacks();
+        }
+    }
+#endif // WITH_RIVE
+}
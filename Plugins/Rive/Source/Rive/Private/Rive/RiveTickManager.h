@@ -0,0 +1,58 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+
+class URiveArtboard;
+class UWorld;
+
+/**
+ * Advances the state machines of every initialized artboard at the start of
+ * the frame, spread over task graph workers. URiveArtboard::Tick then only has
+ * to render them.
+ *
+ * Each world advances its own artboards with its own delta, dilated and
+ * paused like the actors that own them. Only artboards that were ticked by
+ * their owner on the previous frame, with the delta of their world, are picked
+ * up. The others, such as those with a tick interval, keep advancing inline
+ * from URiveArtboard::Tick. Inputs set after the advance are applied by
+ * URiveArtboard::Tick. Reported events and ViewModel callbacks are dispatched
+ * on the game thread, in registration order.
+ */
+class FRiveTickManager
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    static FRiveTickManager& Get();
+
+    void Startup();
+    void Shutdown();
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    void Register(URiveArtboard* InArtboard);
+    void Unregister(URiveArtboard* InArtboard);
+
+private:
+    void OnWorldTickStart(UWorld* InWorld,
+                          ELevelTick InTickType,
+                          float InDeltaSeconds);
+
+    void AdvanceArtboards(const UWorld& InWorld, float InDeltaSeconds);
+
+    /**
+     * Attribute(s)
+     */
+
+    TArray<TWeakObjectPtr<URiveArtboard>> Artboards;
+
+    FDelegateHandle OnWorldTickStartHandle;
+};
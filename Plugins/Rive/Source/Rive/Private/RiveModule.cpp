@@ -5,6 +5,9 @@
 #include "Interfaces/IPluginManager.h"
 #include "Logs/RiveLog.h"
 #include "Misc/Paths.h"
+#include "Rive/Assets/RiveDecodedAssetCache.h"
+#include "Rive/RiveTexturePool.h"
+#include "Rive/RiveTickManager.h"
 #include "ShaderCore.h"
 
 #if WITH_RIVE
@@ -16,9 +19,19 @@ THIRD_PARTY_INCLUDES_END
 
 #define LOCTEXT_NAMESPACE "FRiveModule"
 
-void FRiveModule::StartupModule() { TestRiveIntegration(); }
+void FRiveModule::StartupModule()
+{
+    TestRiveIntegration();
+    FRiveTickManager::Get().Startup();
+}
 
-void FRiveModule::ShutdownModule() { ResetAllShaderSourceDirectoryMappings(); }
+void FRiveModule::ShutdownModule()
+{
+    FRiveTickManager::Get().Shutdown();
+    FRiveDecodedAssetCache::Get().Shutdown();
+    FRiveTexturePool::Get().Shutdown();
+    ResetAllShaderSourceDirectoryMappings();
+}
 
 void FRiveModule::TestRiveIntegration()
 {
@@ -31,7 +44,7 @@ void FRiveModule::TestRiveIntegration()
 
     rive::BinaryReader JuiceRivReader(
         rive::Span(UE::Rive::Tests::JuiceRivFile,
-                   sizeof(&UE::Rive::Tests::JuiceRivFile)));
+                   sizeof(UE::Rive::Tests::JuiceRivFile)));
 
     rive::RuntimeHeader JuiceRivHeader;
 
@@ -1,3 +0,0 @@
-// Copyright Rive, Inc. All rights reserved.
-
-#include "RiveStats.h"
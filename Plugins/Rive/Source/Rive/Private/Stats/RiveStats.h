@@ -1,7 +0,0 @@
-// Copyright Rive, Inc. All rights reserved.
-
-#pragma once
-
-#include "Stats/Stats.h"
-
-DECLARE_STATS_GROUP(TEXT("Rive"), STATGROUP_Rive, STATCAT_Advanced);
@@ -0,0 +1,264 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Tests/RiveTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
+
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveFile.h"
+#include "Rive/RiveStateMachine.h"
+#include "Tests/JuiceRive.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/artboard.hpp"
+#include "rive/core/binary_reader.hpp"
+#include "rive/file.hpp"
+#include "rive/runtime_header.hpp"
+THIRD_PARTY_INCLUDES_END
+
+/**
+ * The embedded Juice file has a single 1080x1080 artboard, "New Artboard",
+ * animated by linear animations only: no state machine, input, event or
+ * ViewModel. The tests of those check the artboard degrades gracefully.
+ */
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRiveFileHeaderTest,
+                                 "Rive.File.Header",
+                                 RIVE_TEST_FLAGS)
+
+bool FRiveFileHeaderTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Rive::Tests;
+
+    rive::BinaryReader Reader(
+        rive::Span<const uint8>(JuiceRivFile, sizeof(JuiceRivFile)));
+    rive::RuntimeHeader Header;
+    if (!TestTrue(TEXT("The header is read"),
+                  rive::RuntimeHeader::read(Reader, Header)))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Major version"),
+              Header.majorVersion(),
+              static_cast<int>(rive::File::majorVersion));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRiveFileImportTest,
+                                 "Rive.File.Import",
+                                 RIVE_TEST_FLAGS)
+
+bool FRiveFileImportTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Rive::Tests;
+
+    URiveFile* RiveFile = ImportJuiceFile(*this);
+    if (RiveFile == nullptr)
+    {
+        return false;
+    }
+
+    TestNotNull(TEXT("Native file"), RiveFile->GetNativeFile());
+    TestEqual(TEXT("Artboard names"),
+              RiveFile->ArtboardNames,
+              TArray<FString>{TEXT("New Artboard")});
+    TestNotNull(TEXT("Artboard metadata"),
+                RiveFile->FindArtboardMetadata(TEXT("New Artboard")));
+    TestNull(TEXT("Missing artboard metadata"),
+             RiveFile->FindArtboardMetadata(TEXT("Missing")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRiveFileImportInvalidTest,
+                                 "Rive.File.ImportInvalid",
+                                 RIVE_TEST_FLAGS)
+
+bool FRiveFileImportInvalidTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Rive::Tests;
+
+    AddExpectedError(TEXT("Failed to load rive file"),
+                     EAutomationExpectedErrorFlags::Contains,
+                     1);
+
+    // A valid header with a truncated body
+    URiveFile* RiveFile =
+        ImportRiveFile(*this, TArray<uint8>(JuiceRivFile, 16));
+    if (RiveFile == nullptr)
+    {
+        return false;
+    }
+
+    TestFalse(TEXT("The file is initialized"), RiveFile->IsInitialized());
+    TestNull(TEXT("Native file"), RiveFile->GetNativeFile());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRiveArtboardInstanceTest,
+                                 "Rive.Artboard.Instance",
+                                 RIVE_TEST_FLAGS)
+
+bool FRiveArtboardInstanceTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Rive::Tests;
+
+    URiveFile* RiveFile = ImportJuiceFile(*this);
+    if (RiveFile == nullptr)
+    {
+        return false;
+    }
+
+    URiveArtboard* Artboard = NewObject<URiveArtboard>();
+    Artboard->Initialize(RiveFile, nullptr);
+    if (!TestTrue(TEXT("The artboard is initialized"),
+                  Artboard->IsInitialized()))
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("Name"), Artboard->GetArtboardName(), TEXT("New Artboard"));
+    TestEqual(TEXT("Original size"),
+              Artboard->GetOriginalSize(),
+              FVector2f(JuiceSize, JuiceSize));
+    Artboard->SetSize(FVector2f(JuiceSize / 2.f, JuiceSize));
+    TestEqual(TEXT("Size"),
+              Artboard->GetSize(),
+              FVector2f(JuiceSize / 2.f, JuiceSize));
+
+    // Every URiveArtboard owns its own instance of the file's artboard
+    URiveArtboard* OtherArtboard = NewObject<URiveArtboard>();
+    AddExpectedError(TEXT("out of bounds"),
+                     EAutomationExpectedErrorFlags::Contains,
+                     1);
+    OtherArtboard->Initialize(RiveFile, nullptr, 5, FString());
+    TestTrue(TEXT("An out of bounds index falls back to the last artboard"),
+             OtherArtboard->IsInitialized());
+    TestNotEqual(TEXT("Native instances"),
+                 Artboard->GetNativeArtboard(),
+                 OtherArtboard->GetNativeArtboard());
+
+    Artboard->Deinitialize();
+    OtherArtboard->Deinitialize();
+    TestFalse(TEXT("The artboard is deinitialized"),
+              Artboard->IsInitialized());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRiveArtboardInputsTest,
+                                 "Rive.Artboard.Inputs",
+                                 RIVE_TEST_FLAGS)
+
+bool FRiveArtboardInputsTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Rive::Tests;
+
+    URiveFile* RiveFile = ImportJuiceFile(*this);
+    if (RiveFile == nullptr)
+    {
+        return false;
+    }
+
+    URiveArtboard* Artboard = NewObject<URiveArtboard>();
+    Artboard->Initialize(RiveFile, nullptr);
+
+    const FRiveStateMachine* StateMachine = Artboard->GetStateMachine();
+    TestTrue(TEXT("Juice has no state machine"),
+             StateMachine == nullptr || !StateMachine->IsValid());
+
+    const FRiveInputHandle Handle = Artboard->GetInputHandle(TEXT("Missing"));
+    TestFalse(TEXT("Handle of a missing input"),
+              Artboard->IsInputHandleValid(Handle));
+    TestFalse(TEXT("Set through an invalid handle"),
+              Artboard->SetBoolValueByHandle(Handle, true));
+    TestFalse(TEXT("Set through an invalid handle"),
+              Artboard->SetNumberValueByHandle(Handle, 1.f));
+    TestFalse(TEXT("Fire through an invalid handle"),
+              Artboard->FireTriggerByHandle(Handle));
+
+    // Missing inputs are ignored and read as their default value
+    Artboard->SetBoolValue(TEXT("Missing"), true);
+    Artboard->SetNumberValue(TEXT("Missing"), 1.f);
+    TestFalse(TEXT("Bool value"), Artboard->GetBoolValue(TEXT("Missing")));
+    TestEqual(TEXT("Number value"),
+              Artboard->GetNumberValue(TEXT("Missing")),
+              0.f);
+
+    Artboard->Deinitialize();
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRiveArtboardEventsTest,
+                                 "Rive.Artboard.Events",
+                                 RIVE_TEST_FLAGS)
+
+bool FRiveArtboardEventsTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Rive::Tests;
+
+    URiveFile* RiveFile = ImportJuiceFile(*this);
+    if (RiveFile == nullptr)
+    {
+        return false;
+    }
+
+    URiveArtboard* Artboard = NewObject<URiveArtboard>();
+    Artboard->Initialize(RiveFile, nullptr);
+    TestTrue(TEXT("Event names"), Artboard->GetEventNames().IsEmpty());
+
+    AddExpectedError(TEXT("does not exist"),
+                     EAutomationExpectedErrorFlags::Contains,
+                     2);
+    URiveArtboard::FRiveNamedEventDelegate Delegate;
+    TestFalse(TEXT("Bind a missing event"),
+              Artboard->BindNamedRiveEvent(TEXT("Missing"), Delegate));
+    TestFalse(TEXT("Unbind a missing event"),
+              Artboard->UnbindNamedRiveEvent(TEXT("Missing"), Delegate));
+
+    FRiveEvent Event;
+    Event.Name = TEXT("Event");
+    FRiveEvent SameEvent = Event;
+    TestTrue(TEXT("Copies of an event are equal"), Event == SameEvent);
+    TestEqual(TEXT("Copies of an event hash the same"),
+              GetTypeHash(Event),
+              GetTypeHash(SameEvent));
+
+    Artboard->Deinitialize();
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRiveFileViewModelsTest,
+                                 "Rive.File.ViewModels",
+                                 RIVE_TEST_FLAGS)
+
+bool FRiveFileViewModelsTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Rive::Tests;
+
+    URiveFile* RiveFile = ImportJuiceFile(*this);
+    if (RiveFile == nullptr)
+    {
+        return false;
+    }
+
+    URiveArtboard* Artboard = NewObject<URiveArtboard>();
+    Artboard->Initialize(RiveFile, nullptr);
+
+    TestEqual(TEXT("ViewModel count"), RiveFile->GetViewModelCount(), 0);
+    TestNull(TEXT("ViewModel by index"), RiveFile->GetViewModelByIndex(0));
+    TestNull(TEXT("ViewModel by name"),
+             RiveFile->GetViewModelByName(TEXT("Missing")));
+    TestNull(TEXT("Default ViewModel"),
+             RiveFile->GetDefaultArtboardViewModel(Artboard));
+
+    // Binding nothing leaves the artboard as it was
+    AddExpectedError(TEXT("SetViewModelInstance failed"),
+                     EAutomationExpectedErrorFlags::Contains,
+                     1);
+    Artboard->SetViewModelInstance(nullptr);
+    TestTrue(TEXT("The artboard is initialized"), Artboard->IsInitialized());
+
+    Artboard->Deinitialize();
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
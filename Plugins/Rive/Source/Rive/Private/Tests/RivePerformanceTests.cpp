@@ -0,0 +1,216 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Tests/RiveTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
+
+#include "HAL/IConsoleManager.h"
+#include "IRiveRenderTarget.h"
+#include "RenderingThread.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveFile.h"
+#include "RiveScopeLock.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/animation/linear_animation_instance.hpp"
+#include "rive/artboard.hpp"
+THIRD_PARTY_INCLUDES_END
+
+static TAutoConsoleVariable<float> CVarRiveTestsAdvanceBudget(
+    TEXT("r.rive.tests.advancebudget"),
+    16.f,
+    TEXT("Milliseconds Rive.Performance.AdvanceJuice may spend advancing its "
+         "1000 artboards in one frame, at the 95th percentile."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRiveTestsDrawBudget(
+    TEXT("r.rive.tests.drawbudget"),
+    8.f,
+    TEXT("Milliseconds Rive.Performance.RecordJuice may spend recording the "
+         "draws of its 1000 artboards in one frame, at the 95th percentile."),
+    ECVF_Default);
+
+namespace UE::Private::RivePerformanceTests
+{
+constexpr int32 InstanceCount = 1000;
+constexpr int32 FrameCount = 60;
+constexpr float DeltaSeconds = 1.f / 60.f;
+
+/** Juice artboards sharing one render target, with their linear animation */
+struct FJuiceInstances
+{
+    FJuiceInstances(URiveFile* InRiveFile,
+                    const TSharedPtr<IRiveRenderTarget>& InRiveRenderTarget)
+    {
+        Artboards.Reserve(InstanceCount);
+        Animations.Reserve(InstanceCount);
+        for (int32 Index = 0; Index < InstanceCount; ++Index)
+        {
+            URiveArtboard* Artboard = NewObject<URiveArtboard>();
+            Artboard->Initialize(InRiveFile, InRiveRenderTarget);
+            Artboards.Emplace(Artboard);
+            Animations.Add(Artboard->GetNativeArtboard()->animationAt(0));
+        }
+    }
+
+    ~FJuiceInstances()
+    {
+        for (const TStrongObjectPtr<URiveArtboard>& Artboard : Artboards)
+        {
+            Artboard->Deinitialize();
+        }
+    }
+
+    void Advance()
+    {
+        for (int32 Index = 0; Index < InstanceCount; ++Index)
+        {
+            URiveArtboard* Artboard = Artboards[Index].Get();
+            Artboard->AdvanceStateMachine(DeltaSeconds);
+            // Also advances the artboard, under its lock like the renderer
+            FRiveScopeLock Lock(&Artboard->GetArtboardCS().Get());
+            Animations[Index]->advanceAndApply(DeltaSeconds);
+        }
+    }
+
+    void Draw()
+    {
+        for (const TStrongObjectPtr<URiveArtboard>& Artboard : Artboards)
+        {
+            Artboard->Draw();
+        }
+    }
+
+    TArray<TStrongObjectPtr<URiveArtboard>> Artboards;
+    TArray<std::unique_ptr<rive::LinearAnimationInstance>> Animations;
+};
+
+/** Times InFrame FrameCount times after a warm up frame, in milliseconds */
+template <typename TFrame>
+TArray<double> TimeFrames(TFrame&& InFrame)
+{
+    InFrame();
+
+    TArray<double> Samples;
+    Samples.Reserve(FrameCount);
+    for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        InFrame();
+        Samples.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+    return Samples;
+}
+
+void CheckBudget(FAutomationTestBase& InTest,
+                 const TCHAR* InStage,
+                 const TArray<double>& InSamples,
+                 float InBudget)
+{
+    using namespace UE::Rive::Tests;
+
+    const double P50 = GetPercentile(InSamples, 50.0);
+    const double P95 = GetPercentile(InSamples, 95.0);
+    InTest.AddInfo(FString::Printf(
+        TEXT("%s %d Juice instances: p50 %.3f ms, p95 %.3f ms per frame"),
+        InStage,
+        InstanceCount,
+        P50,
+        P95));
+    if (P95 > InBudget)
+    {
+        InTest.AddError(
+            FString::Printf(TEXT("%s took %.3f ms at p95, over the %.3f ms "
+                                 "budget"),
+                            InStage,
+                            P95,
+                            InBudget));
+    }
+}
+} // namespace UE::Private::RivePerformanceTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRivePerformanceAdvanceJuiceTest,
+                                 "Rive.Performance.AdvanceJuice",
+                                 RIVE_PERF_TEST_FLAGS)
+
+bool FRivePerformanceAdvanceJuiceTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RivePerformanceTests;
+    using namespace UE::Rive::Tests;
+
+    URiveFile* RiveFile = ImportJuiceFile(*this);
+    if (RiveFile == nullptr)
+    {
+        return false;
+    }
+
+    // Artboards without a render target are never advanced
+    FRenderTarget RenderTarget(*this, 256);
+    if (!TestValid(TEXT("Render target"), RenderTarget.RiveRenderTarget))
+    {
+        return false;
+    }
+
+    FJuiceInstances Instances(RiveFile, RenderTarget.RiveRenderTarget);
+    if (!TestNotNull(TEXT("Juice animation"), Instances.Animations[0].get()))
+    {
+        return false;
+    }
+
+    const TArray<double> Samples =
+        TimeFrames([&Instances]() { Instances.Advance(); });
+    CheckBudget(*this,
+                TEXT("Advancing"),
+                Samples,
+                CVarRiveTestsAdvanceBudget.GetValueOnGameThread());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRivePerformanceRecordJuiceTest,
+                                 "Rive.Performance.RecordJuice",
+                                 RIVE_PERF_TEST_FLAGS)
+
+bool FRivePerformanceRecordJuiceTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RivePerformanceTests;
+    using namespace UE::Rive::Tests;
+
+    URiveFile* RiveFile = ImportJuiceFile(*this);
+    if (RiveFile == nullptr)
+    {
+        return false;
+    }
+
+    FRenderTarget RenderTarget(*this, 256);
+    if (!TestValid(TEXT("Render target"), RenderTarget.RiveRenderTarget))
+    {
+        return false;
+    }
+
+    FJuiceInstances Instances(RiveFile, RenderTarget.RiveRenderTarget);
+    Instances.Advance();
+
+    // Only the recording is timed, not the replay on the render thread. The
+    // first frame warms up the command buffers.
+    TArray<double> Samples;
+    Samples.Reserve(FrameCount);
+    for (int32 Frame = 0; Frame <= FrameCount; ++Frame)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        Instances.Draw();
+        if (Frame > 0)
+        {
+            Samples.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+        }
+        RenderTarget.RiveRenderTarget->Submit();
+        FlushRenderingCommands();
+    }
+
+    CheckBudget(*this,
+                TEXT("Recording"),
+                Samples,
+                CVarRiveTestsDrawBudget.GetValueOnGameThread());
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
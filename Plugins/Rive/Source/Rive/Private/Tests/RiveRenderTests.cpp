@@ -0,0 +1,143 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Tests/RiveTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
+
+#include "Algo/Count.h"
+#include "IRiveRenderTarget.h"
+#include "RenderingThread.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveFile.h"
+#include "RiveSoftwareRenderer.h"
+#include "Tests/JuiceRive.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/artboard.hpp"
+#include "rive/file.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/shapes/paint/color.hpp"
+THIRD_PARTY_INCLUDES_END
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRiveRenderRecordCommandsTest,
+                                 "Rive.Render.RecordCommands",
+                                 RIVE_TEST_FLAGS)
+
+bool FRiveRenderRecordCommandsTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Rive::Tests;
+
+    URiveFile* RiveFile = ImportJuiceFile(*this);
+    if (RiveFile == nullptr)
+    {
+        return false;
+    }
+
+    constexpr int32 Size = 256;
+    FRenderTarget RenderTarget(*this, Size);
+    if (!TestValid(TEXT("Render target"), RenderTarget.RiveRenderTarget))
+    {
+        return false;
+    }
+
+    URiveArtboard* Artboard = NewObject<URiveArtboard>();
+    Artboard->Initialize(RiveFile, RenderTarget.RiveRenderTarget);
+    Artboard->AdvanceStateMachine(1.f / 60.f);
+
+    // Contain scales the square artboard down to the square target
+    Artboard->Align(ERiveFitType::Contain, ERiveAlignment::Center, 1.f);
+    const FMatrix Transform = Artboard->GetTransformMatrix();
+    const double Scale = Size / JuiceSize;
+    TestEqual(TEXT("Scale"), Transform.M[0][0], Scale, 1.e-4);
+    TestEqual(TEXT("Scale"), Transform.M[1][1], Scale, 1.e-4);
+
+    Artboard->Draw();
+    TestTrue(TEXT("The draw keeps the transform it was recorded with"),
+             Artboard->GetLastDrawTransformMatrix().Equals(Transform));
+
+    // The recorded commands replay on the render thread before the artboard
+    // is deinitialized
+    RenderTarget.RiveRenderTarget->Submit();
+    FlushRenderingCommands();
+    Artboard->Deinitialize();
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRiveRenderSoftwareTest,
+                                 "Rive.Render.Software",
+                                 RIVE_TEST_FLAGS)
+
+bool FRiveRenderSoftwareTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Rive::Tests;
+
+    FRiveSoftwareFactory Factory;
+    FRiveSoftwareCanvas Canvas;
+    TArray<FColor> Pixels;
+
+    // An opaque red rectangle, its right edge halfway through a pixel
+    {
+        Canvas.Resize(8, 8);
+        Canvas.Clear(FLinearColor::Transparent);
+        FRiveSoftwareRenderer Renderer(Canvas);
+
+        rive::RawPath RawPath;
+        RawPath.addRect(rive::AABB(2.f, 2.f, 6.5f, 6.f));
+        rive::rcp<rive::RenderPath> Path =
+            Factory.makeRenderPath(RawPath, rive::FillRule::nonZero);
+        rive::rcp<rive::RenderPaint> Paint = Factory.makeRenderPaint();
+        Paint->color(rive::colorARGB(255, 255, 0, 0));
+        Renderer.drawPath(Path.get(), Paint.get());
+        Renderer.Flush();
+        Canvas.ReadPixels(Pixels);
+
+        TestEqual(TEXT("Inside"), Pixels[4 * 8 + 4], FColor(255, 0, 0, 255));
+        TestEqual(TEXT("Outside"), Pixels[0], FColor(0, 0, 0, 0));
+        TestEqual(TEXT("Outside"), Pixels[7 * 8 + 7], FColor(0, 0, 0, 0));
+        TestTrue(TEXT("Half covered edge"),
+                 FMath::Abs(Pixels[4 * 8 + 6].A - 128) <= 2);
+    }
+
+    // Juice, imported with the software factory and fit in the top left
+    // quarter of the canvas
+    {
+        constexpr int32 Size = 128;
+        Canvas.Resize(Size, Size);
+        Canvas.Clear(FLinearColor::Transparent);
+        FRiveSoftwareRenderer Renderer(Canvas);
+
+        rive::ImportResult ImportResult;
+        const std::unique_ptr<rive::File> NativeFile = rive::File::import(
+            rive::Span<const uint8>(JuiceRivFile, sizeof(JuiceRivFile)),
+            &Factory,
+            &ImportResult);
+        if (!TestTrue(TEXT("Juice is imported"),
+                      ImportResult == rive::ImportResult::success))
+        {
+            return false;
+        }
+
+        const std::unique_ptr<rive::ArtboardInstance> NativeArtboard =
+            NativeFile->artboardDefault();
+        NativeArtboard->advance(0.f);
+        Renderer.save();
+        Renderer.align(rive::Fit::contain,
+                       rive::Alignment::center,
+                       rive::AABB(0.f, 0.f, Size / 2, Size / 2),
+                       NativeArtboard->bounds());
+        NativeArtboard->draw(&Renderer);
+        Renderer.restore();
+        Renderer.Flush();
+        Canvas.ReadPixels(Pixels);
+
+        const int32 Covered = Algo::CountIf(Pixels, [](const FColor& Pixel) {
+            return Pixel.A > 0;
+        });
+        TestTrue(TEXT("Pixels are drawn"), Covered > 0);
+        TestTrue(TEXT("Pixels are left transparent"),
+                 Covered <= Pixels.Num() / 4);
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
@@ -0,0 +1,116 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Tests/RiveTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
+
+#include "Engine/Texture2DDynamic.h"
+#include "HAL/IConsoleManager.h"
+#include "IRiveRenderer.h"
+#include "IRiveRendererModule.h"
+#include "IRiveRenderTarget.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+#include "Rive/RiveFile.h"
+#include "Tests/JuiceRive.h"
+
+namespace UE::Rive::Tests
+{
+IRiveRenderer* GetRenderer(FAutomationTestBase& InTest)
+{
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::IsAvailable()
+                                      ? IRiveRendererModule::Get().GetRenderer()
+                                      : nullptr;
+    if (RiveRenderer == nullptr)
+    {
+        InTest.AddError(TEXT("There is no Rive renderer for this RHI"));
+        return nullptr;
+    }
+
+    if (!RiveRenderer->IsInitialized())
+    {
+        RiveRenderer->Initialize();
+        FlushRenderingCommands();
+    }
+    return RiveRenderer;
+}
+
+URiveFile* ImportRiveFile(FAutomationTestBase& InTest,
+                          const TArray<uint8>& InBytes)
+{
+    if (GetRenderer(InTest) == nullptr)
+    {
+        return nullptr;
+    }
+
+    URiveFile* RiveFile = NewObject<URiveFile>(GetTransientPackage());
+    RiveFile->SetRiveFileData(InBytes);
+
+    // Tests check the result right away, so the import can't be deferred to
+    // a worker thread
+    IConsoleVariable* AsyncFileImport =
+        IConsoleManager::Get().FindConsoleVariable(
+            TEXT("r.rive.asyncfileimport"));
+    const int32 PreviousAsyncFileImport = AsyncFileImport->GetInt();
+    AsyncFileImport->Set(0, ECVF_SetByCode);
+    RiveFile->Initialize();
+    AsyncFileImport->Set(PreviousAsyncFileImport, ECVF_SetByCode);
+    return RiveFile;
+}
+
+URiveFile* ImportJuiceFile(FAutomationTestBase& InTest)
+{
+    URiveFile* RiveFile = ImportRiveFile(
+        InTest,
+        TArray<uint8>(JuiceRivFile, sizeof(JuiceRivFile)));
+    if (RiveFile == nullptr ||
+        !InTest.TestTrue(TEXT("The Juice file is initialized"),
+                         RiveFile->IsInitialized()))
+    {
+        return nullptr;
+    }
+    return RiveFile;
+}
+
+FRenderTarget::FRenderTarget(FAutomationTestBase& InTest, int32 InSize)
+{
+    IRiveRenderer* RiveRenderer = GetRenderer(InTest);
+    if (RiveRenderer == nullptr)
+    {
+        return;
+    }
+
+    Texture.Reset(UTexture2DDynamic::Create(InSize, InSize, PF_R8G8B8A8));
+    RiveRenderTarget = RiveRenderer->CreateTextureTarget_GameThread(
+        MakeUniqueObjectName(GetTransientPackage(),
+                             UTexture2DDynamic::StaticClass(),
+                             TEXT("RiveTestTarget")),
+        Texture.Get());
+    if (RiveRenderTarget)
+    {
+        RiveRenderTarget->Initialize();
+        FlushRenderingCommands();
+    }
+}
+
+FRenderTarget::~FRenderTarget()
+{
+    // The render thread may still reference the artboards drawn
+    FlushRenderingCommands();
+}
+
+double GetPercentile(TArray<double> InSamples, double InPercentile)
+{
+    if (InSamples.IsEmpty())
+    {
+        return 0.0;
+    }
+
+    InSamples.Sort();
+    const int32 Rank =
+        FMath::CeilToInt32(InPercentile / 100.0 * InSamples.Num());
+    return InSamples[FMath::Clamp(Rank - 1, 0, InSamples.Num() - 1)];
+}
+} // namespace UE::Rive::Tests
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
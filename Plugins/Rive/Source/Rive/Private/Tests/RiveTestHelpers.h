@@ -0,0 +1,71 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
+
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/StrongObjectPtr.h"
+
+/** Rive tests run in the editor, games and headless (-nullrhi) runs alike */
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+#define RIVE_TEST_FLAGS                                                        \
+    (EAutomationTestFlags::ApplicationContextMask |                            \
+     EAutomationTestFlags::EngineFilter)
+#define RIVE_PERF_TEST_FLAGS                                                   \
+    (EAutomationTestFlags::ApplicationContextMask |                            \
+     EAutomationTestFlags::PerfFilter)
+#else // UE_VERSION_OLDER_THAN(5, 5, 0)
+#define RIVE_TEST_FLAGS                                                        \
+    (EAutomationTestFlags_ApplicationContextMask |                             \
+     EAutomationTestFlags::EngineFilter)
+#define RIVE_PERF_TEST_FLAGS                                                   \
+    (EAutomationTestFlags_ApplicationContextMask |                             \
+     EAutomationTestFlags::PerfFilter)
+#endif // UE_VERSION_OLDER_THAN(5, 5, 0)
+
+class IRiveRenderer;
+class IRiveRenderTarget;
+class URiveArtboard;
+class URiveFile;
+class UTexture2DDynamic;
+
+namespace UE::Rive::Tests
+{
+/** Artboard size of the embedded Juice file */
+constexpr float JuiceSize = 1080.f;
+
+/**
+ * Returns the renderer, initializing it if the engine loop did not yet. Adds
+ * an error to InTest if there is none.
+ */
+IRiveRenderer* GetRenderer(FAutomationTestBase& InTest);
+
+/**
+ * Imports InBytes into a new transient URiveFile on the game thread. The file
+ * is returned even if the import failed.
+ */
+URiveFile* ImportRiveFile(FAutomationTestBase& InTest,
+                          const TArray<uint8>& InBytes);
+
+/** Imports the embedded Juice file, nullptr on failure */
+URiveFile* ImportJuiceFile(FAutomationTestBase& InTest);
+
+/** Texture and render target the artboards of a test record their draws in */
+struct FRenderTarget
+{
+    FRenderTarget(FAutomationTestBase& InTest, int32 InSize);
+    ~FRenderTarget();
+
+    TStrongObjectPtr<UTexture2DDynamic> Texture;
+    TSharedPtr<IRiveRenderTarget> RiveRenderTarget;
+};
+
+/** Milliseconds at InPercentile (0 to 100) of InSamples, nearest rank */
+double GetPercentile(TArray<double> InSamples, double InPercentile);
+} // namespace UE::Rive::Tests
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_RIVE
@@ -135,7 +135,8 @@ TSharedRef<SWidget> URiveWidget::RebuildWidget()
 
     if (!RiveTextureObject && RiveWidget.IsValid())
     {
-        RiveTextureObject = NewObject<URiveTextureObject>();
+        // Outered to this widget so its artboard ticks with the widget's world
+        RiveTextureObject = NewObject<URiveTextureObject>(this);
         RiveTextureObject->Size =
             FIntPoint::ZeroValue; // Setting to zero value here will make the
                                   // rive texture use the artboard size
@@ -297,35 +298,21 @@ FReply URiveWidget::OnInput(
 
 TArray<FString> URiveWidget::GetArtboardNamesForDropdown() const
 {
-    TArray<FString> Output;
-
     if (RiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* Artboard : RiveDescriptor.RiveFile->Artboards)
-        {
-            Output.Add(Artboard->GetArtboardName());
-        }
+        return RiveDescriptor.RiveFile->GetArtboardNamesForDropdown();
     }
-
-    return Output;
+    return {};
 }
 
 TArray<FString> URiveWidget::GetStateMachineNamesForDropdown() const
 {
-    TArray<FString> Output{""};
     if (RiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* Artboard : RiveDescriptor.RiveFile->Artboards)
-        {
-            if (Artboard->GetArtboardName().Equals(RiveDescriptor.ArtboardName))
-            {
-                Output.Append(Artboard->GetStateMachineNames());
-                break;
-            }
-        }
+        return RiveDescriptor.RiveFile->GetStateMachineNamesForDropdown(
+            RiveDescriptor.ArtboardName);
     }
-
-    return Output;
+    return {""};
 }
 
 #if WITH_EDITOR
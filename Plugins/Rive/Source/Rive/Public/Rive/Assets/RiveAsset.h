@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Serialization/BulkData.h"
 #include "UObject/Object.h"
 
 #if WITH_RIVE
@@ -14,6 +15,16 @@ THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 #include "RiveAsset.generated.h"
 
+/** Progress of an asset decoded on demand, see bLoadAssetsOnDemand */
+enum class ERiveOnDemandLoadState : uint8
+{
+    /** Decoded with its file, or on demand and done */
+    None,
+    /** Waiting for an artboard that uses it, or a prefetch */
+    Pending,
+    Loading,
+};
+
 UENUM(BlueprintType)
 enum class ERiveAssetType : uint8
 {
@@ -34,6 +45,7 @@ class RIVE_API URiveAsset : public UObject
 
 public:
     virtual void PostLoad() override;
+    virtual void Serialize(FArchive& Ar) override;
     virtual bool LoadNativeAssetBytes(rive::FileAsset& InAsset,
                                       rive::Factory* InRiveFactory,
                                       const rive::Span<const uint8>& AssetBytes)
@@ -60,7 +72,19 @@ public:
     FString AssetPath;
 
     UPROPERTY()
-    TArray<uint8> NativeAssetBytes;
+    TArray<uint8> NativeAssetBytes_DEPRECATED;
+
+    /** Bytes of an out of band asset, only read from disk while decoding */
+    FByteBulkData NativeAssetBulkData;
+
+    bool HasNativeAssetBytes() const
+    {
+        return NativeAssetBulkData.GetBulkDataSize() > 0;
+    }
+    void GetNativeAssetBytes(TArray<uint8>& OutBytes);
+    void SetNativeAssetBytes(const TArray<uint8>& InBytes);
 
     rive::Asset* NativeAsset;
+
+    ERiveOnDemandLoadState OnDemandLoadState = ERiveOnDemandLoadState::None;
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Serialization/BulkData.h"
 
 enum class ERiveAssetType : uint8;
 class URiveAsset;
@@ -25,6 +26,20 @@ public:
 
     static ERiveAssetType GetUnrealType(uint16_t RiveType);
 
+    /**
+     * Replaces the payload of InOutBulkData with InBytes. The payload is
+     * saved apart from the package export so it is only read when needed.
+     */
+    static void SetBulkData(FByteBulkData& InOutBulkData,
+                            const TArray<uint8>& InBytes);
+
+    /**
+     * Copies the payload of InBulkData, reading it from disk if needed, and
+     * frees the bulk data's own copy when it can be read again
+     */
+    static void ReadBulkData(FByteBulkData& InBulkData,
+                             TArray<uint8>& OutBytes);
+
     inline const static TArray<FString> FontExtensions = {"ttf", "otf"};
     inline const static TArray<FString> ImageExtensions = {"png"};
     inline const static TArray<FString> AudioExtensions = {"wav",
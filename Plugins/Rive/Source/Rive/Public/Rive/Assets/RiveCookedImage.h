@@ -0,0 +1,36 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Image of a rive file decoded when the file was cooked, so loading the cooked
+ * file uploads its pixels instead of running an image codec
+ */
+struct FRiveCookedImage
+{
+    /** Hash of the encoded bytes, see FRiveDecodedAssetCache::HashBytes */
+    uint64 Hash = 0;
+
+    uint32 Width = 0;
+
+    uint32 Height = 0;
+
+    /** Where the 8 bit BGRA pixels start in the cooked image bulk data */
+    int64 Offset = 0;
+
+    int64 GetSizeInBytes() const
+    {
+        return static_cast<int64>(Width) * Height * 4;
+    }
+
+    friend FArchive& operator<<(FArchive& Ar, FRiveCookedImage& InImage)
+    {
+        Ar << InImage.Hash;
+        Ar << InImage.Width;
+        Ar << InImage.Height;
+        Ar << InImage.Offset;
+        return Ar;
+    }
+};
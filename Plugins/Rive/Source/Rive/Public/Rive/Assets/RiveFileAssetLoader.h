@@ -3,20 +3,26 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Rive/Assets/RiveCookedImage.h"
 #include "UObject/ObjectPtr.h"
 
 #if WITH_RIVE
 
+class IRiveRenderer;
 class URiveAsset;
 class URiveTextureObject;
 
 namespace rive
 {
 class Asset;
+class FileAsset;
+class ImageAsset;
+class RenderImage;
 }
 
 THIRD_PARTY_INCLUDES_START
 #include "rive/file_asset_loader.hpp"
+#include "rive/refcnt.hpp"
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 
@@ -35,8 +41,51 @@ class RIVE_API FRiveFileAssetLoader
      */
 
 public:
+    /**
+     * With bInDeferObjectCreation, loadContents does not create or replace
+     * UObjects so it can run off the game thread. Call ReplaceOutdatedAssets
+     * before and CreateDeferredAssets after the import, on the game thread.
+     */
     FRiveFileAssetLoader(UObject* InOuter,
-                         TMap<uint32, TObjectPtr<URiveAsset>>& InAssets);
+                         TMap<uint32, TObjectPtr<URiveAsset>>& InAssets,
+                         bool bInDeferObjectCreation = false);
+
+    /** Replaces the assets whose class does not match their type */
+    void ReplaceOutdatedAssets();
+
+#if WITH_RIVE
+
+    /** Wraps the in band assets decoded by a deferred import in URiveAssets */
+    void CreateDeferredAssets();
+
+    /**
+     * Decodes the images collected by loadContents, in parallel when the
+     * renderer allows it. Images with the same bytes share one render image,
+     * across files. Call once the import succeeded, while its bytes are alive.
+     */
+    void DecodePendingImages(IRiveRenderer* InRiveRenderer);
+
+    /**
+     * Lets DecodePendingImages upload the images decoded when the file was
+     * cooked instead of decoding them. Both views must outlive the decode.
+     */
+    void SetCookedImages(TConstArrayView<FRiveCookedImage> InImages,
+                         TConstArrayView<uint8> InPixels)
+    {
+        CookedImages = InImages;
+        CookedImagePixels = InPixels;
+    }
+
+    /**
+     * Leaves out of band assets undecoded and marks them Pending, for
+     * URiveFile::RequestArtboardAssets to decode them on demand
+     */
+    void SetLoadOutOfBandAssetsOnDemand(bool bInOnDemand)
+    {
+        bLoadOutOfBandAssetsOnDemand = bInOnDemand;
+    }
+
+#endif // WITH_RIVE
 
 #if WITH_RIVE
 
@@ -49,6 +98,24 @@ public:
 
     //~ END : rive::FileAssetLoader Interface
 
+private:
+    URiveAsset* CreateInBandAsset(rive::FileAsset& InAsset);
+
+    /** Called from DecodePendingImages with the renderer's lock held */
+    rive::rcp<rive::RenderImage> MakeCookedImage(
+        IRiveRenderer* InRiveRenderer,
+        const FRiveCookedImage& InImage) const;
+
+    /** Keeps a copy of InBytes in InBandImageBytes until images are decoded */
+    rive::Span<const uint8> KeepInBandImageBytes(
+        rive::Span<const uint8> InBytes);
+
+    struct FPendingImage
+    {
+        rive::ImageAsset* Asset;
+        rive::Span<const uint8> Bytes;
+    };
+
 #endif // WITH_RIVE
 
 public:
@@ -59,4 +126,28 @@ public:
 private:
     TObjectPtr<UObject> Outer;
     TMap<uint32, TObjectPtr<URiveAsset>>& Assets;
+    bool bDeferObjectCreation;
+
+#if WITH_RIVE
+
+    TArray<rive::FileAsset*> DeferredAssets;
+
+    TArray<FPendingImage> PendingImages;
+
+    /** Out of band asset bytes read from bulk data, kept until decoded */
+    TArray<TArray<uint8>> OutOfBandAssetBytes;
+
+    /**
+     * Copies of the in band bytes of pending images, which the importer frees
+     * before DecodePendingImages runs
+     */
+    TArray<TArray<uint8>> InBandImageBytes;
+
+    TConstArrayView<FRiveCookedImage> CookedImages;
+
+    TConstArrayView<uint8> CookedImagePixels;
+
+    bool bLoadOutOfBandAssetsOnDemand = false;
+
+#endif // WITH_RIVE
 };
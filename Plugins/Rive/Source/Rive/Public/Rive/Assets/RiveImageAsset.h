@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RHIResources.h"
 #include "RiveAsset.h"
 #include "RiveImageAsset.generated.h"
 
@@ -14,6 +15,7 @@ class RIVE_API URiveImageAsset : public URiveAsset
 {
     GENERATED_BODY()
 
+public:
     URiveImageAsset();
 
     UFUNCTION(BlueprintCallable, Category = Rive)
@@ -22,6 +24,19 @@ class RIVE_API URiveImageAsset : public URiveAsset
     UFUNCTION(BlueprintCallable, Category = Rive)
     void LoadImageBytes(const TArray<uint8>& InBytes);
 
+    /**
+     * Replaces the image with raw 8 bit pixels, InWidth * InHeight * 4 bytes,
+     * without going through an image codec
+     */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void LoadImagePixels(const TArray<uint8>& InPixels,
+                         int32 InWidth,
+                         int32 InHeight,
+                         bool bInIsBGRA = true);
+
+    /** Replaces the image with InTexture, which is sampled without a copy */
+    void LoadTextureRHI(const FTextureRHIRef& InTexture);
+
     virtual bool LoadNativeAssetBytes(
         rive::FileAsset& InAsset,
         rive::Factory* InRiveFactory,
@@ -4,6 +4,8 @@
 #include "MatrixTypes.h"
 #include "RiveAudioEngine.h"
 #include "RiveEvent.h"
+#include "RiveInputHandle.h"
+#include "RiveInputValue.h"
 #include "RiveTypes.h"
 #include "RiveStateMachine.h"
 
@@ -23,6 +25,7 @@ UCLASS(BlueprintType)
 class RIVE_API URiveArtboard : public UObject
 {
     friend URiveFile;
+    friend class FRiveTickManager;
     GENERATED_BODY()
 
 public:
@@ -64,6 +67,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = Rive)
     void SetStateMachineName(const FString& NewStateMachineName);
 
+    /**
+     * How soon the assets this artboard uses are decoded when it is
+     * initialized, if its file loads its assets on demand
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    ERiveAssetLoadPriority AssetLoadPriority = ERiveAssetLoadPriority::Normal;
+
     UPROPERTY(BlueprintReadWrite, Category = Rive)
     FRiveTickDelegate OnArtboardTick_Render;
 
@@ -170,6 +180,40 @@ public:
                             const FString& InPath,
                             bool& OutSuccess);
 
+    /** Resolves a state machine input once, see FRiveInputHandle */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    FRiveInputHandle GetInputHandle(const FString& InInputName) const;
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    FRiveInputHandle GetInputHandleAtPath(const FString& InInputName,
+                                          const FString& InPath) const;
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool IsInputHandleValid(const FRiveInputHandle& InHandle) const;
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool FireTriggerByHandle(const FRiveInputHandle& InHandle) const;
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool GetBoolValueByHandle(const FRiveInputHandle& InHandle) const;
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool SetBoolValueByHandle(const FRiveInputHandle& InHandle,
+                              bool bNewValue);
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    float GetNumberValueByHandle(const FRiveInputHandle& InHandle) const;
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool SetNumberValueByHandle(const FRiveInputHandle& InHandle,
+                                float NewValue);
+
+    /**
+     * Applies every entry of InValues under a single lock acquisition. Returns
+     * how many were applied, the indices of the others are returned in
+     * OutFailedIndices and only a single warning is logged for all of them.
+     */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    int32 SetInputValues(const TArray<FRiveInputValue>& InValues,
+                         TArray<int32>& OutFailedIndices);
+
     UFUNCTION(BlueprintCallable, Category = Rive)
     bool BindNamedRiveEvent(const FString& EventName,
                             const FRiveNamedEventDelegate& Event);
@@ -257,6 +301,21 @@ public:
 
     FRiveStateMachine* GetStateMachine() const;
 
+    /**
+     * Guards the native artboard and its state machine. Held by the render
+     * thread while the artboard is drawn.
+     */
+    const TSharedRef<FCriticalSection>& GetArtboardCS() const
+    {
+        return ArtboardCS;
+    }
+
+    /**
+     * False when the last advance left the artboard untouched and no input
+     * changed since, so its owner can keep the previously rendered texture.
+     */
+    bool NeedsRedraw() const;
+
     void BeginInput() { bIsReceivingInput = true; }
 
     void EndInput() { bIsReceivingInput = false; }
@@ -269,6 +328,13 @@ public:
 private:
     void PopulateReportedEvents();
 
+    /** Advances InStateMachine and records whether it changed the artboard */
+    void Advance_Internal(FRiveStateMachine& InStateMachine,
+                          float InDeltaSeconds);
+
+    FRiveInputHandle MakeInputHandle(rive::SMIInput* InInput,
+                                     const FString& InInputName) const;
+
     void Initialize_Internal(const rive::Artboard* InNativeArtboard);
     void Tick_Render(float InDeltaSeconds);
     void Tick_StateMachine(float InDeltaSeconds);
@@ -279,6 +345,29 @@ private:
 
     std::unique_ptr<rive::ArtboardInstance> NativeArtboardPtr = nullptr;
     TUniquePtr<FRiveStateMachine> StateMachinePtr = nullptr;
+
+    TSharedRef<FCriticalSection> ArtboardCS = MakeShared<FCriticalSection>();
+
+    /** Frames at which Tick was last called and the state machine advanced,
+     * used by FRiveTickManager */
+    uint64 LastTickFrame = 0;
+    uint64 LastAdvanceFrame = 0;
+    /** Delta Tick was last called with, which differs from the world's when
+     * the owner has a tick interval or its own time dilation */
+    float LastTickDeltaSeconds = 0.f;
+
+    /** Bumped whenever the native state machine inputs are destroyed, which
+     * invalidates every FRiveInputHandle resolved before */
+    uint32 InputGeneration = 1;
+
+    /** Set by inputs, text runs, size and ViewModel changes, consumed by the
+     * next advance */
+    mutable bool bHasPendingChanges = true;
+    /** Whether the last advance changed the artboard, see NeedsRedraw */
+    bool bNeedsRedraw = true;
+
+    /** "<File>/<Artboard>", the name of this artboard's spans on RiveChannel */
+    FString TraceName;
 #endif // WITH_RIVE
 public:
     const FString& GetArtboardName() const { return ArtboardName; }
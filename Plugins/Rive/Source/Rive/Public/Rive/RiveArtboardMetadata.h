@@ -0,0 +1,64 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RiveInputHandle.h"
+#include "RiveArtboardMetadata.generated.h"
+
+USTRUCT(BlueprintType)
+struct RIVE_API FRiveStateMachineInputMetadata
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = Rive)
+    FString Name;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = Rive)
+    ERiveInputType Type = ERiveInputType::None;
+};
+
+USTRUCT(BlueprintType)
+struct RIVE_API FRiveStateMachineMetadata
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = Rive)
+    FString Name;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = Rive)
+    TArray<FRiveStateMachineInputMetadata> Inputs;
+};
+
+/**
+ * What a RiveFile knows about one of its artboards without instancing it. Read
+ * from the artboard definitions when the file is imported.
+ */
+USTRUCT(BlueprintType)
+struct RIVE_API FRiveArtboardMetadata
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = Rive)
+    FString Name;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = Rive)
+    FVector2f Size = FVector2f::ZeroVector;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = Rive)
+    TArray<FRiveStateMachineMetadata> StateMachines;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = Rive)
+    TArray<FString> EventNames;
+
+    TArray<FString> GetStateMachineNames() const
+    {
+        TArray<FString> Names;
+        Names.Reserve(StateMachines.Num());
+        for (const FRiveStateMachineMetadata& StateMachine : StateMachines)
+        {
+            Names.Add(StateMachine.Name);
+        }
+        return Names;
+    }
+};
@@ -0,0 +1,29 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+
+/** Serialization versions of the rive assets */
+struct RIVE_API FRiveCustomVersion
+{
+    enum Type
+    {
+        BeforeCustomVersionWasAdded = 0,
+
+        /** RiveFileData and NativeAssetBytes moved to bulk data */
+        BulkDataPayloads,
+
+        /** Cooked rive files carry their images decoded */
+        CookedImages,
+
+        VersionPlusOne,
+        LatestVersion = VersionPlusOne - 1
+    };
+
+    static const FGuid GUID;
+
+private:
+    FRiveCustomVersion() {}
+};
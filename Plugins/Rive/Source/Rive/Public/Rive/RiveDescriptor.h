@@ -44,4 +44,9 @@ public:
 
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
     float ScaleFactor = 1.0f;
+
+    // How soon the assets of the artboard are decoded, if the Rive File loads
+    // its assets on demand
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    ERiveAssetLoadPriority AssetLoadPriority = ERiveAssetLoadPriority::Normal;
 };
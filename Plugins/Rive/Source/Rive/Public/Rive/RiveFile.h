@@ -3,9 +3,12 @@
 
 #include <memory>
 #include "Assets/RiveAsset.h"
+#include "Assets/RiveCookedImage.h"
 #include "Blueprint/UserWidget.h"
 #include "CoreMinimal.h"
+#include "RiveArtboardMetadata.h"
 #include "RiveTypes.h"
+#include "Serialization/BulkData.h"
 #include "UObject/Object.h"
 
 #if WITH_RIVE
@@ -18,9 +21,11 @@ THIRD_PARTY_INCLUDES_END
 
 #include "RiveFile.generated.h"
 
+class IRiveRenderer;
 class URiveAsset;
 class URiveArtboard;
 class URiveViewModel;
+class UTexture2D;
 
 /**
  *
@@ -40,6 +45,12 @@ public:
 
     void BeginDestroy() override;
     void PostLoad() override;
+    void Serialize(FArchive& Ar) override;
+#if WITH_EDITOR
+    void BeginCacheForCookedPlatformData(
+        const ITargetPlatform* TargetPlatform) override;
+    void ClearAllCachedCookedPlatformData() override;
+#endif // WITH_EDITOR
     void Initialize();
 
     void SetWidgetClass(TSubclassOf<UUserWidget> InWidgetClass)
@@ -70,14 +81,17 @@ public:
               meta = (NoResetToDefault, AllowPrivateAccess))
     TArray<FString> ArtboardNames;
 
-    // This is only meant as a display feature for the editor, and not meant to
-    // be used as functional code
+    /**
+     * Names, sizes, state machines, inputs and events of every artboard, read
+     * from the file without instancing the artboards
+     */
     UPROPERTY(Transient,
               VisibleInstanceOnly,
+              BlueprintReadOnly,
               Category = Rive,
               NonTransactional,
               meta = (NoResetToDefault, AllowPrivateAccess))
-    TArray<URiveArtboard*> Artboards;
+    TArray<FRiveArtboardMetadata> ArtboardMetadata;
 
     UFUNCTION()
     TArray<FString> GetArtboardNamesForDropdown() const
@@ -85,6 +99,14 @@ public:
         return ArtboardNames;
     }
 
+    /** Metadata of the artboard named InArtboardName, if the file has one */
+    const FRiveArtboardMetadata* FindArtboardMetadata(
+        const FString& InArtboardName) const;
+
+    /** Dropdown options for a state machine of InArtboardName, "" first */
+    TArray<FString> GetStateMachineNamesForDropdown(
+        const FString& InArtboardName) const;
+
     UPROPERTY(Transient,
               VisibleInstanceOnly,
               Category = Rive,
@@ -92,6 +114,41 @@ public:
               meta = (NoResetToDefault, AllowPrivateAccess))
     TArray<URiveViewModel*> ViewModels;
 
+    /**
+     * Decode out of band assets once an artboard using them is initialized,
+     * or when they are prefetched, instead of with the file. Until then images
+     * show PlaceholderImage and text using their fonts is not drawn.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Rive)
+    bool bLoadAssetsOnDemand = false;
+
+    /** Shown by images loaded on demand until they are decoded */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadOnly,
+              Category = Rive,
+              meta = (EditCondition = "bLoadAssetsOnDemand"))
+    TObjectPtr<UTexture2D> PlaceholderImage;
+
+    /**
+     * Starts decoding the assets loaded on demand that InArtboardNames use,
+     * or every one of them if InArtboardNames is empty. Meant for loading
+     * screens, along with AreAssetsLoaded.
+     */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void PrefetchAssets(
+        const TArray<FString>& InArtboardNames,
+        ERiveAssetLoadPriority InPriority = ERiveAssetLoadPriority::Normal);
+
+    /** Whether the assets InArtboardNames use, or all if empty, are decoded */
+    UFUNCTION(BlueprintPure, Category = Rive)
+    bool AreAssetsLoaded(const TArray<FString>& InArtboardNames) const;
+
+#if WITH_RIVE
+    /** Decodes the assets loaded on demand that InArtboard uses */
+    void RequestArtboardAssets(const rive::Artboard& InArtboard,
+                               ERiveAssetLoadPriority InPriority);
+#endif // WITH_RIVE
+
     UPROPERTY(meta = (NoResetToDefault))
     FString RiveFilePath_DEPRECATED;
 
@@ -102,6 +159,38 @@ public:
 #endif
 
 private:
+#if WITH_RIVE
+    /** Imports on a background thread, then finishes on the game thread */
+    void ImportAsync(IRiveRenderer* InRiveRenderer, double InStartTime);
+
+    /** Takes ownership of the imported file and broadcasts the result */
+    void FinishInitialization(std::unique_ptr<rive::File> InNativeFile,
+                              double InStartTime,
+                              bool bInAsync);
+
+    /** Adds the assets still loading on demand that InArtboard uses */
+    void FindOnDemandAssets(const rive::Artboard& InArtboard,
+                            TArray<URiveAsset*>& OutAssets) const;
+
+    /** Same for InArtboardNames, or for every artboard if it is empty */
+    void FindOnDemandAssets(const TArray<FString>& InArtboardNames,
+                            TArray<URiveAsset*>& OutAssets) const;
+
+    void LoadAssetOnDemand(URiveAsset* InAsset,
+                           ERiveAssetLoadPriority InPriority);
+
+    /**
+     * Called on the game thread with the image or font decoded for an asset
+     * loaded on demand, null if the decode failed
+     */
+    void FinishAssetLoad(URiveAsset* InAsset,
+                         rive::rcp<rive::RenderImage> InImage,
+                         rive::rcp<rive::Font> InFont);
+#endif // WITH_RIVE
+
+    /** Bumped by each import, so loads started by a previous one are dropped */
+    uint32 ImportGeneration = 0;
+
     void BroadcastInitializationResult(bool bSuccess);
     TOptional<bool> WasLastInitializationSuccessful{};
     FOnRiveFileInitializationResult OnInitializedOnceDelegate;
@@ -110,7 +199,24 @@ private:
     ERiveInitState InitState = ERiveInitState::Uninitialized;
 
     UPROPERTY()
-    TArray<uint8> RiveFileData;
+    TArray<uint8> RiveFileData_DEPRECATED;
+
+    /** The .riv bytes, only read from disk while the file is imported */
+    FByteBulkData RiveFileBulkData;
+
+    /** Copy of RiveFileBulkData backing RiveNativeFileSpan during import */
+    TArray<uint8> ImportBytes;
+
+    /** Images decoded when the file was cooked, only set in cooked builds */
+    TArray<FRiveCookedImage> CookedImages;
+
+    /** Pixels of CookedImages */
+    FByteBulkData CookedImageBulkData;
+
+    /** Copy of CookedImageBulkData used during import */
+    TArray<uint8> CookedImagePixels;
+
+    void ReleaseImportBytes();
 
     UPROPERTY(VisibleAnywhere, Category = Rive, meta = (NoResetToDefault))
     TSubclassOf<UUserWidget> WidgetClass;
@@ -165,6 +271,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Rive|File")
     URiveViewModel* GetDefaultArtboardViewModel(URiveArtboard* Artboard) const;
 
+    /**
+     * Only valid while the file is imported, rive::File does not reference
+     * its bytes afterwards so they are released
+     */
     rive::Span<const uint8> RiveNativeFileSpan;
     rive::Span<const uint8>& GetNativeFileSpan() { return RiveNativeFileSpan; }
 
@@ -182,6 +292,12 @@ public:
 
     void PrintStats() const;
 
+    /**
+     * Sets the .riv bytes of a file that was not imported as an asset, like
+     * the fixtures of the automation tests. Initialize then imports them.
+     */
+    void SetRiveFileData(const TArray<uint8>& InRiveFileBuffer);
+
 #if WITH_EDITOR
 
     bool EditorImport(const FString& InRiveFilePath,
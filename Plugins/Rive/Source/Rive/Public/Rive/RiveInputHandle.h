@@ -0,0 +1,66 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "RiveInputHandle.generated.h"
+
+class URiveArtboard;
+
+namespace rive
+{
+class SMIInput;
+}
+
+UENUM(BlueprintType)
+enum class ERiveInputType : uint8
+{
+    None = 0,
+    Bool,
+    Number,
+    Trigger
+};
+
+/**
+ * A state machine input resolved once by name through
+ * URiveArtboard::GetInputHandle. Setting or getting a value through the handle
+ * skips the name lookup. The handle becomes invalid when the artboard is
+ * deinitialized, reinitialized or changes state machine.
+ */
+USTRUCT(BlueprintType)
+struct RIVE_API FRiveInputHandle
+{
+    GENERATED_BODY()
+
+    friend URiveArtboard;
+
+public:
+    ERiveInputType GetType() const { return Type; }
+
+    const FString& GetName() const { return Name; }
+
+    /**
+     * Attribute(s)
+     */
+
+private:
+    UPROPERTY(VisibleInstanceOnly,
+              BlueprintReadOnly,
+              Category = Rive,
+              meta = (AllowPrivateAccess))
+    ERiveInputType Type = ERiveInputType::None;
+
+    UPROPERTY(VisibleInstanceOnly,
+              BlueprintReadOnly,
+              Category = Rive,
+              meta = (AllowPrivateAccess))
+    FString Name;
+
+    TWeakObjectPtr<URiveArtboard> Artboard;
+
+    rive::SMIInput* NativeInput = nullptr;
+
+    /** URiveArtboard input generation at the time this was resolved */
+    uint32 Generation = 0;
+};
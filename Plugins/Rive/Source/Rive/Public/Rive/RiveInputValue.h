@@ -0,0 +1,96 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RiveInputValue.generated.h"
+
+UENUM(BlueprintType)
+enum class ERiveInputValueType : uint8
+{
+    Bool = 0,
+    Number,
+    Trigger,
+    Text
+};
+
+/**
+ * A single write applied by URiveArtboard::SetInputValues. Bool, Number and
+ * Trigger target a state machine input, Text targets a text run. When Path is
+ * empty the input is looked up on the artboard's own state machine.
+ */
+USTRUCT(BlueprintType)
+struct RIVE_API FRiveInputValue
+{
+    GENERATED_BODY()
+
+    static FRiveInputValue MakeBool(const FString& InName, bool bInValue)
+    {
+        FRiveInputValue Value;
+        Value.Type = ERiveInputValueType::Bool;
+        Value.Name = InName;
+        Value.bBoolValue = bInValue;
+        return Value;
+    }
+
+    static FRiveInputValue MakeNumber(const FString& InName, float InValue)
+    {
+        FRiveInputValue Value;
+        Value.Type = ERiveInputValueType::Number;
+        Value.Name = InName;
+        Value.NumberValue = InValue;
+        return Value;
+    }
+
+    static FRiveInputValue MakeTrigger(const FString& InName)
+    {
+        FRiveInputValue Value;
+        Value.Type = ERiveInputValueType::Trigger;
+        Value.Name = InName;
+        return Value;
+    }
+
+    static FRiveInputValue MakeText(const FString& InName,
+                                    const FString& InValue)
+    {
+        FRiveInputValue Value;
+        Value.Type = ERiveInputValueType::Text;
+        Value.Name = InName;
+        Value.TextValue = InValue;
+        return Value;
+    }
+
+    /**
+     * Attribute(s)
+     */
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive)
+    ERiveInputValueType Type = ERiveInputValueType::Bool;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive)
+    FString Name;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive)
+    FString Path;
+
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (EditCondition = "Type == ERiveInputValueType::Bool",
+                      EditConditionHides))
+    bool bBoolValue = false;
+
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (EditCondition = "Type == ERiveInputValueType::Number",
+                      EditConditionHides))
+    float NumberValue = 0.f;
+
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (EditCondition = "Type == ERiveInputValueType::Text",
+                      EditConditionHides))
+    FString TextValue;
+};
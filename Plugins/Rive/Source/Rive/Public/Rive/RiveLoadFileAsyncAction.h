@@ -0,0 +1,63 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "UObject/SoftObjectPtr.h"
+#include "RiveLoadFileAsyncAction.generated.h"
+
+class URiveFile;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRiveLoadFileAsyncDelegate,
+                                            URiveFile*,
+                                            RiveFile);
+
+/**
+ * Latent "Load Rive File Async" node. Streams the RiveFile asset in if needed
+ * and completes once the file has been imported, which happens on a
+ * background thread (see r.rive.asyncfileimport).
+ */
+UCLASS()
+class RIVE_API URiveLoadFileAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable,
+              Category = "Rive|File",
+              meta = (BlueprintInternalUseOnly = "true",
+                      DisplayName = "Load Rive File Async",
+                      WorldContext = "WorldContextObject"))
+    static URiveLoadFileAsyncAction* LoadRiveFileAsync(
+        UObject* WorldContextObject,
+        TSoftObjectPtr<URiveFile> RiveFile);
+
+    //~ BEGIN : UBlueprintAsyncActionBase Interface
+    virtual void Activate() override;
+    //~ END : UBlueprintAsyncActionBase Interface
+
+    /** Called once the file is loaded and initialized */
+    UPROPERTY(BlueprintAssignable)
+    FRiveLoadFileAsyncDelegate OnLoaded;
+
+    /** Called if the asset could not be loaded or the file failed to import */
+    UPROPERTY(BlueprintAssignable)
+    FRiveLoadFileAsyncDelegate OnFailed;
+
+private:
+    void OnPackageLoaded(const FName& InPackageName,
+                         UPackage* InPackage,
+                         EAsyncLoadingResult::Type InResult);
+
+    void WaitForInitialization();
+
+    void OnFileInitialized(bool bInSuccess);
+
+    void Finish(bool bInSuccess);
+
+    TSoftObjectPtr<URiveFile> SoftRiveFile;
+
+    UPROPERTY(Transient)
+    TObjectPtr<URiveFile> RiveFile;
+};
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RiveInputValue.h"
 
 #if WITH_RIVE
 
@@ -37,16 +38,29 @@ public:
     bool IsValid() const { return NativeStateMachinePtr != nullptr; }
 #if WITH_RIVE
 
-    explicit FRiveStateMachine(rive::ArtboardInstance* InNativeArtboardInst,
-                               const FString& InStateMachineName);
+    /**
+     * InArtboardCS is the lock of the owning artboard, the state machine
+     * mutates the artboard when advanced so they have to share it.
+     */
+    explicit FRiveStateMachine(
+        rive::ArtboardInstance* InNativeArtboardInst,
+        const FString& InStateMachineName,
+        const TSharedRef<FCriticalSection>& InArtboardCS);
 
     /**
      * Implementation(s)
      */
 
 public:
+    /** Returns false once the state machine has nothing left to animate */
     bool Advance(float InSeconds);
 
+    /**
+     * True when the last advance left the artboard untouched: the state
+     * machine had settled and no input changed since the advance before.
+     */
+    bool IsSettled() const;
+
     uint32 GetInputCount() const;
 
     rive::SMIInput* GetInput(uint32 AtIndex) const;
@@ -61,6 +75,17 @@ public:
 
     void SetNumberValue(const FString& InPropertyName, float NewValue);
 
+    /**
+     * Applies the Bool, Number and Trigger entries of InValues under a single
+     * lock. Returns how many were applied, the indices of the others are
+     * added to OutFailedIndices and nothing is logged for them.
+     */
+    int32 SetInputValues(TConstArrayView<FRiveInputValue> InValues,
+                         TArray<int32>& OutFailedIndices);
+
+    /** Applies one entry looked up by InName, the artboard lock must be held */
+    bool ApplyInputValue(const FRiveInputValue& InValue, const char* InName);
+
     bool PointerDown(const FVector2f& NewPosition);
 
     bool PointerMove(const FVector2f& NewPosition);
@@ -91,6 +116,13 @@ private:
 
     std::unique_ptr<rive::StateMachineInstance> NativeStateMachinePtr = nullptr;
 
+    TSharedRef<FCriticalSection> ArtboardCS = MakeShared<FCriticalSection>();
+
+    bool bIsSettled = false;
+    bool bKeptGoing = true;
+    /** Set by inputs and pointer events, consumed by the next Advance */
+    mutable bool bHasPendingChanges = true;
+
     static rive::EventReport NullEvent;
 
 #endif // WITH_RIVE
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "RiveArtboard.h"
+#include "Containers/Ticker.h"
 #include "Engine/Texture2DDynamic.h"
 #include "RiveTexture.generated.h"
 
@@ -37,6 +38,10 @@ class RIVE_API URiveTexture : public UTexture2DDynamic
     virtual void PostLoad() override;
     //~ END : UTexture UTexture
 
+    //~ BEGIN : UObject Interface
+    virtual void BeginDestroy() override;
+    //~ END : UObject Interface
+
 public:
     /** UI representation of Texture Size */
     UPROPERTY(BlueprintReadWrite,
@@ -50,7 +55,9 @@ public:
     FIntPoint Size;
 
     /**
-     * Resize render resources
+     * Resize render resources. Once created, the texture is resized
+     * r.rive.resizedelay seconds after the last call, so continuous resizes
+     * only recreate it once they settle
      */
     UFUNCTION(BlueprintCallable, Category = Rive)
     virtual void ResizeRenderTargets(FIntPoint InNewSize);
@@ -72,4 +79,16 @@ protected:
      * Rendering resource for Rive File
      */
     FRiveTextureResource* CurrentResource = nullptr;
+
+private:
+    void ApplySize(const FIntPoint& InNewSize);
+
+    bool TickPendingResize(float InDeltaTime);
+
+    /** Size requested while a resize waits for r.rive.resizedelay */
+    TOptional<FIntPoint> PendingSize;
+
+    double PendingSizeTime = 0.0;
+
+    FTSTicker::FDelegateHandle ResizeTickerHandle;
 };
@@ -58,6 +58,7 @@ public class Rive : ModuleRules
 				"Renderer",
 				"RiveLibrary",
 				"RiveRenderer",
+				"RiveStats",
 				"Slate",
 				"SlateCore",
 				"UMG"
@@ -83,6 +84,7 @@ public class Rive : ModuleRules
 					"UnrealEd",
 					"ViewportInteraction",
 					"AssetTools",
+					"ImageWrapper",
 					"TextureEditor",
 				}
 			);
@@ -0,0 +1,654 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveBenchmarkCommandlet.h"
+
+#include "DynamicRHI.h"
+#include "Engine/Texture2DDynamic.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "IRiveRenderer.h"
+#include "IRiveRendererModule.h"
+#include "IRiveRenderTarget.h"
+#include "Logs/RiveEditorLog.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderingThread.h"
+#include "RiveTypes.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/StrongObjectPtr.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/artboard.hpp"
+#include "rive/file.hpp"
+#include "utils/no_op_factory.hpp"
+#include "utils/no_op_renderer.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace UE::Private::RiveBenchmark
+{
+enum class EStage : uint8
+{
+    Import,
+    Instance,
+    Advance,
+    Draw,
+    Flush,
+    Count
+};
+
+const TCHAR* GetStageName(EStage InStage)
+{
+    switch (InStage)
+    {
+        case EStage::Import:
+            return TEXT("Import");
+        case EStage::Instance:
+            return TEXT("Instance");
+        case EStage::Advance:
+            return TEXT("Advance");
+        case EStage::Draw:
+            return TEXT("Draw");
+        case EStage::Flush:
+            return TEXT("Flush");
+        default:
+            return TEXT("Unknown");
+    }
+}
+
+enum class EPointerEventType : uint8
+{
+    Down,
+    Move,
+    Up
+};
+
+struct FPointerEvent
+{
+    int32 Frame;
+    EPointerEventType Type;
+    rive::Vec2D Position;
+};
+
+struct FSettings
+{
+    FString Path;
+    FString Output;
+    int32 Frames = 600;
+    float DeltaTime = 1.f / 60.f;
+    int32 Runs = 10;
+    int32 Size = 512;
+    TArray<FPointerEvent> Events;
+};
+
+/** Timings of one stage, in milliseconds */
+struct FSamples
+{
+    void Add(double InStartSeconds)
+    {
+        Milliseconds.Add((FPlatformTime::Seconds() - InStartSeconds) * 1000.0);
+    }
+
+    TArray<double> Milliseconds;
+};
+
+struct FSummary
+{
+    int32 Count = 0;
+    double Mean = 0.0;
+    double P50 = 0.0;
+    double P95 = 0.0;
+    double P99 = 0.0;
+    double Max = 0.0;
+};
+
+/** Nearest rank percentiles, so they are actual samples */
+FSummary Summarize(const FSamples& InSamples)
+{
+    FSummary Summary;
+    TArray<double> Sorted = InSamples.Milliseconds;
+    if (Sorted.IsEmpty())
+    {
+        return Summary;
+    }
+
+    Sorted.Sort();
+    auto Percentile = [&Sorted](double InPercentile) {
+        const int32 Rank =
+            FMath::CeilToInt32(InPercentile / 100.0 * Sorted.Num());
+        return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+    };
+
+    double Sum = 0.0;
+    for (double Sample : Sorted)
+    {
+        Sum += Sample;
+    }
+    Summary.Count = Sorted.Num();
+    Summary.Mean = Sum / Sorted.Num();
+    Summary.P50 = Percentile(50.0);
+    Summary.P95 = Percentile(95.0);
+    Summary.P99 = Percentile(99.0);
+    Summary.Max = Sorted.Last();
+    return Summary;
+}
+
+/** One line of the report, Artboard is empty for the file's import */
+struct FResult
+{
+    FString File;
+    FString Artboard;
+    FString StateMachine;
+    EStage Stage;
+    FSummary Summary;
+};
+
+bool ParseEvents(const FString& InFilename, TArray<FPointerEvent>& OutEvents)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *InFilename))
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: unable to read the events file '%s'"),
+               *InFilename);
+        return false;
+    }
+
+    for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+    {
+        const FString Line = Lines[LineIndex].TrimStartAndEnd();
+        if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+        {
+            continue;
+        }
+
+        TArray<FString> Tokens;
+        Line.ParseIntoArrayWS(Tokens);
+        FPointerEvent Event;
+        if (Tokens.Num() != 4 || !Tokens[0].IsNumeric() ||
+            !Tokens[2].IsNumeric() || !Tokens[3].IsNumeric())
+        {
+            UE_LOG(LogRiveEditor,
+                   Error,
+                   TEXT("RiveBenchmark: '%s' line %d should be "
+                        "'<Frame> <down|move|up> <X> <Y>'"),
+                   *InFilename,
+                   LineIndex + 1);
+            return false;
+        }
+        if (Tokens[1] == TEXT("down"))
+        {
+            Event.Type = EPointerEventType::Down;
+        }
+        else if (Tokens[1] == TEXT("move"))
+        {
+            Event.Type = EPointerEventType::Move;
+        }
+        else if (Tokens[1] == TEXT("up"))
+        {
+            Event.Type = EPointerEventType::Up;
+        }
+        else
+        {
+            UE_LOG(LogRiveEditor,
+                   Error,
+                   TEXT("RiveBenchmark: '%s' line %d, unknown event '%s'"),
+                   *InFilename,
+                   LineIndex + 1,
+                   *Tokens[1]);
+            return false;
+        }
+        Event.Frame = FCString::Atoi(*Tokens[0]);
+        Event.Position = rive::Vec2D(FCString::Atof(*Tokens[2]),
+                                     FCString::Atof(*Tokens[3]));
+        OutEvents.Add(Event);
+    }
+
+    OutEvents.StableSort([](const FPointerEvent& A, const FPointerEvent& B) {
+        return A.Frame < B.Frame;
+    });
+    return true;
+}
+
+void SendEvents(const FSettings& InSettings,
+                int32 InFrame,
+                rive::StateMachineInstance* InStateMachine)
+{
+    if (InStateMachine == nullptr)
+    {
+        return;
+    }
+
+    for (const FPointerEvent& Event : InSettings.Events)
+    {
+        if (Event.Frame != InFrame)
+        {
+            continue;
+        }
+        switch (Event.Type)
+        {
+            case EPointerEventType::Down:
+                InStateMachine->pointerDown(Event.Position);
+                break;
+            case EPointerEventType::Move:
+                InStateMachine->pointerMove(Event.Position);
+                break;
+            case EPointerEventType::Up:
+                InStateMachine->pointerUp(Event.Position);
+                break;
+        }
+    }
+}
+
+/** Renderer the draws are recorded and flushed with, if there is one */
+struct FTarget
+{
+    IRiveRenderer* RiveRenderer = nullptr;
+    TStrongObjectPtr<UTexture2DDynamic> Texture;
+    TSharedPtr<IRiveRenderTarget> RenderTarget;
+};
+
+void BenchmarkArtboard(const FSettings& InSettings,
+                       const FString& InFileName,
+                       rive::File& InNativeFile,
+                       int32 InArtboardIndex,
+                       FTarget& InTarget,
+                       TArray<FResult>& OutResults)
+{
+    FSamples Samples[static_cast<int32>(EStage::Count)];
+    auto GetSamples = [&Samples](EStage InStage) -> FSamples& {
+        return Samples[static_cast<int32>(InStage)];
+    };
+
+    std::unique_ptr<rive::ArtboardInstance> Artboard;
+    std::unique_ptr<rive::StateMachineInstance> StateMachine;
+    for (int32 Run = 0; Run < InSettings.Runs; ++Run)
+    {
+        StateMachine.reset();
+        Artboard.reset();
+
+        const double StartSeconds = FPlatformTime::Seconds();
+        Artboard = InNativeFile.artboardAt(InArtboardIndex);
+        if (Artboard)
+        {
+            StateMachine = Artboard->defaultStateMachine();
+            if (!StateMachine && Artboard->stateMachineCount() > 0)
+            {
+                StateMachine = Artboard->stateMachineAt(0);
+            }
+        }
+        GetSamples(EStage::Instance).Add(StartSeconds);
+    }
+    if (!Artboard)
+    {
+        return;
+    }
+
+    rive::NoOpRenderer NoOpRenderer;
+    const FVector2f Alignment =
+        FRiveAlignment::GetAlignment(ERiveAlignment::Center);
+    for (int32 Frame = 0; Frame < InSettings.Frames; ++Frame)
+    {
+        SendEvents(InSettings, Frame, StateMachine.get());
+
+        double StartSeconds = FPlatformTime::Seconds();
+        if (StateMachine)
+        {
+            StateMachine->advanceAndApply(InSettings.DeltaTime);
+        }
+        else
+        {
+            Artboard->advance(InSettings.DeltaTime);
+        }
+        GetSamples(EStage::Advance).Add(StartSeconds);
+
+        StartSeconds = FPlatformTime::Seconds();
+        if (InTarget.RenderTarget)
+        {
+            InTarget.RenderTarget->Align(ERiveFitType::Contain,
+                                         Alignment,
+                                         1.f,
+                                         Artboard.get());
+            InTarget.RenderTarget->Draw(Artboard.get(), nullptr);
+        }
+        else
+        {
+            Artboard->draw(&NoOpRenderer);
+        }
+        GetSamples(EStage::Draw).Add(StartSeconds);
+
+        if (InTarget.RenderTarget)
+        {
+            // The artboard is advanced again next frame, so the render thread
+            // must be done drawing it anyway
+            StartSeconds = FPlatformTime::Seconds();
+            InTarget.RenderTarget->Submit();
+            FlushRenderingCommands();
+            GetSamples(EStage::Flush).Add(StartSeconds);
+        }
+    }
+
+    const FString ArtboardName = UTF8_TO_TCHAR(Artboard->name().c_str());
+    const FString StateMachineName =
+        StateMachine ? UTF8_TO_TCHAR(StateMachine->name().c_str())
+                     : FString();
+    for (int32 Stage = static_cast<int32>(EStage::Instance);
+         Stage < static_cast<int32>(EStage::Count);
+         ++Stage)
+    {
+        if (!Samples[Stage].Milliseconds.IsEmpty())
+        {
+            OutResults.Add({InFileName,
+                            ArtboardName,
+                            StateMachineName,
+                            static_cast<EStage>(Stage),
+                            Summarize(Samples[Stage])});
+        }
+    }
+}
+
+void BenchmarkFile(const FSettings& InSettings,
+                   const FString& InFilename,
+                   rive::Factory* InFactory,
+                   FCriticalSection* InFactoryCS,
+                   FTarget& InTarget,
+                   TArray<FResult>& OutResults)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *InFilename))
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: unable to read '%s'"),
+               *InFilename);
+        return;
+    }
+
+    FString FileName = InFilename;
+    FPaths::MakePathRelativeTo(FileName, *(InSettings.Path / TEXT("")));
+
+    FSamples ImportSamples;
+    std::unique_ptr<rive::File> NativeFile;
+    for (int32 Run = 0; Run < InSettings.Runs; ++Run)
+    {
+        NativeFile.reset();
+
+        TOptional<FScopeLock> Lock;
+        if (InFactoryCS != nullptr)
+        {
+            Lock.Emplace(InFactoryCS);
+        }
+        const double StartSeconds = FPlatformTime::Seconds();
+        rive::ImportResult ImportResult;
+        NativeFile =
+            rive::File::import(rive::Span<const uint8>(Bytes.GetData(),
+                                                       Bytes.Num()),
+                               InFactory,
+                               &ImportResult);
+        ImportSamples.Add(StartSeconds);
+        if (ImportResult != rive::ImportResult::success)
+        {
+            NativeFile.reset();
+        }
+    }
+    if (!NativeFile)
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: unable to import '%s'"),
+               *InFilename);
+        return;
+    }
+
+    OutResults.Add({FileName,
+                    FString(),
+                    FString(),
+                    EStage::Import,
+                    Summarize(ImportSamples)});
+
+    for (size_t Index = 0; Index < NativeFile->artboardCount(); ++Index)
+    {
+        BenchmarkArtboard(InSettings,
+                          FileName,
+                          *NativeFile,
+                          static_cast<int32>(Index),
+                          InTarget,
+                          OutResults);
+    }
+
+    UE_LOG(LogRiveEditor,
+           Display,
+           TEXT("RiveBenchmark: '%s', %d artboard(s)"),
+           *FileName,
+           static_cast<int32>(NativeFile->artboardCount()));
+}
+
+FString GetPluginVersion()
+{
+    const TSharedPtr<IPlugin> Plugin =
+        IPluginManager::Get().FindPlugin(TEXT("Rive"));
+    return Plugin ? Plugin->GetDescriptor().VersionName : FString();
+}
+
+FString WriteCSV(const FSettings& InSettings,
+                 const FString& InRHIName,
+                 const TArray<FResult>& InResults)
+{
+    // The header comment keeps the run reproducible from the report alone
+    FString Output = FString::Printf(
+        TEXT("# Rive %s, Engine %s, RHI %s, Frames %d, DeltaTime %f, Runs %d, "
+             "Size %d\n"),
+        *GetPluginVersion(),
+        *FEngineVersion::Current().ToString(),
+        *InRHIName,
+        InSettings.Frames,
+        InSettings.DeltaTime,
+        InSettings.Runs,
+        InSettings.Size);
+    Output += TEXT("File,Artboard,StateMachine,Stage,Count,MeanMs,P50Ms,P95Ms,"
+                   "P99Ms,MaxMs\n");
+    auto Quote = [](const FString& InValue) {
+        return TEXT("\"") + InValue.Replace(TEXT("\""), TEXT("\"\"")) +
+               TEXT("\"");
+    };
+    for (const FResult& Result : InResults)
+    {
+        Output += FString::Printf(TEXT("%s,%s,%s,%s,%d,%.4f,%.4f,%.4f,%.4f,"
+                                       "%.4f\n"),
+                                  *Quote(Result.File),
+                                  *Quote(Result.Artboard),
+                                  *Quote(Result.StateMachine),
+                                  GetStageName(Result.Stage),
+                                  Result.Summary.Count,
+                                  Result.Summary.Mean,
+                                  Result.Summary.P50,
+                                  Result.Summary.P95,
+                                  Result.Summary.P99,
+                                  Result.Summary.Max);
+    }
+    return Output;
+}
+
+FString WriteJSON(const FSettings& InSettings,
+                  const FString& InRHIName,
+                  const TArray<FResult>& InResults)
+{
+    FString Output;
+    const TSharedRef<TJsonWriter<>> Writer =
+        TJsonWriterFactory<>::Create(&Output);
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("PluginVersion"), GetPluginVersion());
+    Writer->WriteValue(TEXT("EngineVersion"),
+                       FEngineVersion::Current().ToString());
+    Writer->WriteValue(TEXT("RHI"), InRHIName);
+    Writer->WriteValue(TEXT("Frames"), InSettings.Frames);
+    Writer->WriteValue(TEXT("DeltaTime"), InSettings.DeltaTime);
+    Writer->WriteValue(TEXT("Runs"), InSettings.Runs);
+    Writer->WriteValue(TEXT("Size"), InSettings.Size);
+    Writer->WriteArrayStart(TEXT("Results"));
+    for (const FResult& Result : InResults)
+    {
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("File"), Result.File);
+        Writer->WriteValue(TEXT("Artboard"), Result.Artboard);
+        Writer->WriteValue(TEXT("StateMachine"), Result.StateMachine);
+        Writer->WriteValue(TEXT("Stage"), GetStageName(Result.Stage));
+        Writer->WriteValue(TEXT("Count"), Result.Summary.Count);
+        Writer->WriteValue(TEXT("MeanMs"), Result.Summary.Mean);
+        Writer->WriteValue(TEXT("P50Ms"), Result.Summary.P50);
+        Writer->WriteValue(TEXT("P95Ms"), Result.Summary.P95);
+        Writer->WriteValue(TEXT("P99Ms"), Result.Summary.P99);
+        Writer->WriteValue(TEXT("MaxMs"), Result.Summary.Max);
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+    return Output;
+}
+} // namespace UE::Private::RiveBenchmark
+
+URiveBenchmarkCommandlet::URiveBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+    HelpDescription = TEXT("Imports, advances and draws every .riv file of "
+                           "-Path and reports the timings of each stage");
+}
+
+int32 URiveBenchmarkCommandlet::Main(const FString& InParams)
+{
+    using namespace UE::Private::RiveBenchmark;
+
+    FSettings Settings;
+    if (!FParse::Value(*InParams, TEXT("Path="), Settings.Path) ||
+        !FPaths::DirectoryExists(Settings.Path))
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: -Path=<Directory> of .riv files is "
+                    "required"));
+        return 1;
+    }
+    FPaths::NormalizeDirectoryName(Settings.Path);
+
+    if (!FParse::Value(*InParams, TEXT("Output="), Settings.Output))
+    {
+        Settings.Output = FPaths::ProjectSavedDir() /
+                          TEXT("Rive/RiveBenchmark.csv");
+    }
+    FParse::Value(*InParams, TEXT("Frames="), Settings.Frames);
+    FParse::Value(*InParams, TEXT("DeltaTime="), Settings.DeltaTime);
+    FParse::Value(*InParams, TEXT("Runs="), Settings.Runs);
+    FParse::Value(*InParams, TEXT("Size="), Settings.Size);
+    Settings.Frames = FMath::Max(1, Settings.Frames);
+    Settings.Runs = FMath::Max(1, Settings.Runs);
+    Settings.Size = FMath::Max(1, Settings.Size);
+
+    FString EventsFilename;
+    if (FParse::Value(*InParams, TEXT("Events="), EventsFilename) &&
+        !ParseEvents(EventsFilename, Settings.Events))
+    {
+        return 1;
+    }
+
+    TArray<FString> Filenames;
+    IFileManager::Get().FindFilesRecursive(Filenames,
+                                           *Settings.Path,
+                                           TEXT("*.riv"),
+                                           true,
+                                           false);
+    // Same order on every machine, so reports can be diffed
+    Filenames.Sort();
+    if (Filenames.IsEmpty())
+    {
+        UE_LOG(LogRiveEditor,
+               Warning,
+               TEXT("RiveBenchmark: no .riv file found in '%s'"),
+               *Settings.Path);
+    }
+
+    // Commandlets don't tick the engine loop the renderer is initialized from
+    FTarget Target;
+    Target.RiveRenderer = IRiveRendererModule::IsAvailable()
+                              ? IRiveRendererModule::Get().GetRenderer()
+                              : nullptr;
+    if (Target.RiveRenderer && !Target.RiveRenderer->IsInitialized())
+    {
+        Target.RiveRenderer->Initialize();
+        FlushRenderingCommands();
+    }
+
+    rive::Factory* Factory = nullptr;
+    if (Target.RiveRenderer)
+    {
+        FScopeLock Lock(&Target.RiveRenderer->GetThreadDataCS());
+        Factory = Target.RiveRenderer->GetFactory();
+    }
+
+    rive::NoOpFactory NoOpFactory;
+    FCriticalSection* FactoryCS = nullptr;
+    if (Factory != nullptr)
+    {
+        FactoryCS = &Target.RiveRenderer->GetThreadDataCS();
+        Target.Texture.Reset(UTexture2DDynamic::Create(Settings.Size,
+                                                       Settings.Size,
+                                                       PF_R8G8B8A8));
+        Target.RenderTarget =
+            Target.RiveRenderer->CreateTextureTarget_GameThread(
+                TEXT("RiveBenchmark"),
+                Target.Texture.Get());
+        if (Target.RenderTarget)
+        {
+            Target.RenderTarget->Initialize();
+            FlushRenderingCommands();
+        }
+    }
+    else
+    {
+        UE_LOG(LogRiveEditor,
+               Warning,
+               TEXT("RiveBenchmark: no Rive renderer, files are imported "
+                    "with a no-op factory and flush is not measured"));
+        Factory = &NoOpFactory;
+    }
+
+    const FString RHIName = GDynamicRHI ? GDynamicRHI->GetName() : TEXT("None");
+    TArray<FResult> Results;
+    for (const FString& Filename : Filenames)
+    {
+        BenchmarkFile(Settings,
+                      Filename,
+                      Factory,
+                      FactoryCS,
+                      Target,
+                      Results);
+    }
+
+    Target.RenderTarget.Reset();
+    FlushRenderingCommands();
+
+    const bool bJSON =
+        FPaths::GetExtension(Settings.Output).Equals(TEXT("json"));
+    const FString Report = bJSON ? WriteJSON(Settings, RHIName, Results)
+                                 : WriteCSV(Settings, RHIName, Results);
+    if (!FFileHelper::SaveStringToFile(Report, *Settings.Output))
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: unable to write '%s'"),
+               *Settings.Output);
+        return 1;
+    }
+
+    UE_LOG(LogRiveEditor,
+           Display,
+           TEXT("RiveBenchmark: %d file(s), report written to '%s'"),
+           Filenames.Num(),
+           *Settings.Output);
+    return 0;
+}
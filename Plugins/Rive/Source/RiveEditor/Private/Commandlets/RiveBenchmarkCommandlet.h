@@ -0,0 +1,43 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "RiveBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the cost of Rive files outside of a running game. Every .riv file
+ * found under -Path is imported, each of its artboards instanced with its
+ * default state machine, then advanced at a fixed time step and drawn.
+ * Import, instance, advance, draw (recording the commands) and flush
+ * (replaying them on the render thread) are timed separately and reported
+ * as p50 / p95 / p99 per artboard.
+ *
+ * UnrealEditor-Cmd <Project> -run=RiveBenchmark -Path=<Directory>
+ *     [-Output=<File.csv|File.json>] [-Frames=600] [-DeltaTime=0.0166667]
+ *     [-Runs=10] [-Size=512] [-Events=<File>]
+ *
+ * -Events names a text file of pointer events, one per line as
+ * "<Frame> <down|move|up> <X> <Y>" in artboard space, sent to the state
+ * machine before the frame is advanced. Lines starting with # are ignored.
+ * Flush is only reported when a Rive renderer exists, with -nullrhi it
+ * measures the headless renderer.
+ */
+UCLASS()
+class URiveBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+    /**
+     * Structor(s)
+     */
+
+public:
+    URiveBenchmarkCommandlet();
+
+    //~ BEGIN : UCommandlet Interface
+public:
+    virtual int32 Main(const FString& InParams) override;
+    //~ END : UCommandlet Interface
+};
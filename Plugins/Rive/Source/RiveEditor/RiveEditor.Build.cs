@@ -38,7 +38,11 @@ public class RiveEditor : ModuleRules
                 "EditorStyle",
                 "UnrealEd",
                 "DeveloperSettings",
-                "RiveRenderer"
+                "RiveRenderer",
+                "Json",
+                "Projects",
+                "RHI",
+                "RenderCore"
             }
         );
 
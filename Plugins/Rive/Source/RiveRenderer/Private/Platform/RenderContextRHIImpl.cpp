@@ -13,6 +13,8 @@
 
 #include "RenderGraphUtils.h"
 #include "Logs/RiveRendererLog.h"
+#include "RiveStats.h"
+#include "RiveTrace.h"
 
 #include "HAL/IConsoleManager.h"
 
@@ -132,6 +134,24 @@ static TAutoConsoleVariable<int32> CVarShouldVisualizeRive(
     ECVF_Scalability | ECVF_RenderThreadSafe);
 // clang-format on
 
+static TAutoConsoleVariable<int32> CVarBatchFrameGraph(
+    TEXT("r.rive.batchframegraph"),
+    0,
+    TEXT("If non 0, the render targets flushed while a world ticks are "
+         "recorded into one render graph and executed together once its "
+         "actors have ticked, before its viewports render. Each ticking world "
+         "executes its own graph, targets flushed outside a world tick are "
+         "executed right away."),
+    ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarImageMips(
+    TEXT("r.rive.imagemips"),
+    1,
+    TEXT("If non 0, images decoded from rive files get a full mip chain so "
+         "they don't alias when drawn smaller than they are. Only applies to "
+         "images decoded afterwards."),
+    ECVF_Default);
+
 void GetPermutationForFeatures(
     const ShaderFeatures features,
     const ShaderMiscFlags miscFlags,
@@ -303,31 +323,89 @@ BufferRingRHIImpl::BufferRingRHIImpl(EBufferUsageFlags flags,
     BufferRing(inSizeInBytes), m_flags(flags), m_stride(stride)
 {}
 
-FBufferRHIRef BufferRingRHIImpl::Sync(FRHICommandList& commandList,
-                                      size_t offsetInBytes) const
+FBufferRHIRef BufferRingRHIImpl::Sync(FRHICommandList& commandList) const
 {
-    FRHIResourceCreateInfo Info(TEXT("rive.BufferRingRHIImpl_"));
+    if (m_syncedBufferIndex == INDEX_NONE)
+    {
+        const size_t size = UploadSizeInBytes(0);
+        m_syncedBufferIndex = AcquirePooledBuffer(commandList, size);
+
+        // for DX12 we should use RLM_WriteOnly_NoOverwrite but RLM_WriteOnly
+        // works everywhere so we use it for now
+        auto map =
+            commandList.LockBuffer(m_pooledBuffers[m_syncedBufferIndex].Buffer,
+                                   0,
+                                   size,
+                                   RLM_WriteOnly);
+        memcpy(map, shadowBuffer(), size);
+        commandList.UnlockBuffer(m_pooledBuffers[m_syncedBufferIndex].Buffer);
+        INC_DWORD_STAT_BY(STAT_RiveBytesUploaded, size);
+#if RIVE_TRACE_ENABLED
+        UE::Rive::Trace::CountBytesUploaded(size);
+#endif // RIVE_TRACE_ENABLED
+    }
+
+    FPooledBuffer& PooledBuffer = m_pooledBuffers[m_syncedBufferIndex];
+    PooledBuffer.LastUsedFrame = GFrameNumberRenderThread;
+    return PooledBuffer.Buffer;
+}
+
+int32 BufferRingRHIImpl::AcquirePooledBuffer(FRHICommandList& commandList,
+                                             size_t sizeInBytes) const
+{
+    // Flushes batched into one graph all run in the same frame, so a buffer
+    // used this frame is never handed out again before the graph executes.
+    // Prefer the smallest free buffer that fits, then regrow a free one that
+    // is too small, so the pool only grows with the buffers in flight.
+    int32 FitIndex = INDEX_NONE;
+    int32 FreeIndex = INDEX_NONE;
+    for (int32 Index = 0; Index < m_pooledBuffers.Num(); ++Index)
+    {
+        const FPooledBuffer& PooledBuffer = m_pooledBuffers[Index];
+        if (PooledBuffer.LastUsedFrame + kFramesInFlight >
+            GFrameNumberRenderThread)
+        {
+            continue;
+        }
+        FreeIndex = Index;
+        if (PooledBuffer.SizeInBytes >= sizeInBytes &&
+            (FitIndex == INDEX_NONE ||
+             PooledBuffer.SizeInBytes < m_pooledBuffers[FitIndex].SizeInBytes))
+        {
+            FitIndex = Index;
+        }
+    }
+    if (FitIndex != INDEX_NONE)
+    {
+        return FitIndex;
+    }
+
+    // Sized to what was written rather than the ring's capacity, rounded up
+    // so frames of a similar weight keep reusing it
+    const size_t bufferSizeInBytes = FMath::Min(
+        Align(FMath::RoundUpToPowerOfTwo64(sizeInBytes), m_stride),
+        static_cast<uint64>(capacityInBytes()));
+    const int32 Index = FreeIndex != INDEX_NONE
+                            ? FreeIndex
+                            : m_pooledBuffers.AddDefaulted();
 
-    const size_t size = capacityInBytes() - offsetInBytes;
-    auto buffer =
-        commandList.CreateBuffer(size,
-                                 m_flags | EBufferUsageFlags::Volatile,
+    FRHIResourceCreateInfo Info(TEXT("rive.BufferRingRHIImpl_"));
+    FPooledBuffer& PooledBuffer = m_pooledBuffers[Index];
+    PooledBuffer.Buffer =
+        commandList.CreateBuffer(bufferSizeInBytes,
+                                 m_flags | EBufferUsageFlags::Dynamic,
                                  m_stride,
                                  ERHIAccess::WriteOnlyMask,
                                  Info);
-    // for DX12 we should use RLM_WriteOnly_NoOverwrite but RLM_WriteOnly works
-    // everywhere so we use it for now
-    auto map = commandList.LockBuffer(buffer, 0, size, RLM_WriteOnly);
-    memcpy(map, shadowBuffer() + offsetInBytes, size);
-    commandList.UnlockBuffer(buffer);
-
-    return buffer;
+    PooledBuffer.SizeInBytes = bufferSizeInBytes;
+    return Index;
 }
 
 FRDGBufferRef BufferRingRHIImpl::Sync(FRDGBuilder& RDGBuilder,
+                                      ERDGInitialDataFlags InitialDataFlags,
                                       size_t offsetInBytes) const
 {
-    const size_t size = capacityInBytes() - offsetInBytes;
+    const size_t size = UploadSizeInBytes(offsetInBytes);
     // clang was trying to do a copy constructor here for some crazy reason on
     // mac. This prevents that
     FRDGBufferDesc Desc{static_cast<uint32>(m_stride),
@@ -339,12 +417,32 @@ FRDGBufferRef BufferRingRHIImpl::Sync(FRDGBuilder& RDGBuilder,
     RDGBuilder.QueueBufferUpload(buffer,
                                  shadowBuffer() + offsetInBytes,
                                  size,
-                                 ERDGInitialDataFlags::NoCopy);
+                                 InitialDataFlags);
+    INC_DWORD_STAT_BY(STAT_RiveBytesUploaded, size);
+#if RIVE_TRACE_ENABLED
+    UE::Rive::Trace::CountBytesUploaded(size);
+#endif // RIVE_TRACE_ENABLED
     return buffer;
 }
 
+size_t BufferRingRHIImpl::UploadSizeInBytes(size_t offsetInBytes) const
+{
+    check(offsetInBytes <= capacityInBytes());
+    // Only what was mapped this frame holds data, the rest of the ring is
+    // stale once a heavier frame grew it. Never go below one element since
+    // the buffer is still bound when a flush has nothing in it.
+    const size_t writtenSizeInBytes =
+        m_writtenSizeInBytes > offsetInBytes
+            ? m_writtenSizeInBytes - offsetInBytes
+            : 0;
+    return FMath::Min(FMath::Max(writtenSizeInBytes, m_stride),
+                      capacityInBytes() - offsetInBytes);
+}
+
 void* BufferRingRHIImpl::onMapBuffer(int bufferIdx, size_t mapSizeInBytes)
 {
+    m_writtenSizeInBytes = mapSizeInBytes;
+    m_syncedBufferIndex = INDEX_NONE;
     return shadowBuffer();
 }
 
@@ -387,7 +485,88 @@ void* RenderBufferRHIImpl::onMap()
 
 void RenderBufferRHIImpl::onUnmap() { m_buffer.unmapAndSubmitBuffer(); }
 
-#if UE_VERSION_OLDER_THAN(5, 5, 0)
+static uint32_t GetMipDimension(uint32_t size, uint32_t mip)
+{
+    return FMath::Max(size >> mip, 1u);
+}
+
+static uint64 GetMipChainSizeInBytes(uint32_t width,
+                                     uint32_t height,
+                                     uint32_t mipLevelCount)
+{
+    uint64 sizeInBytes = 0;
+    for (uint32_t mip = 0; mip < mipLevelCount; ++mip)
+    {
+        sizeInBytes += static_cast<uint64>(GetMipDimension(width, mip)) *
+                       GetMipDimension(height, mip) * 4;
+    }
+    return sizeInBytes;
+}
+
+/**
+ * Appends box filtered mips, down to 1x1, after the 4 bytes per pixel image in
+ * InOutPixels and returns the resulting mip count. Colors are weighted by
+ * their alpha so transparent texels don't darken the edges.
+ */
+static uint32_t AppendImageMips(uint32_t width,
+                                uint32_t height,
+                                TArray<uint8>& InOutPixels)
+{
+    uint32_t mipLevelCount = 1;
+    int32 srcOffset = 0;
+    while (width > 1 || height > 1)
+    {
+        const uint32_t mipWidth = GetMipDimension(width, 1);
+        const uint32_t mipHeight = GetMipDimension(height, 1);
+        const int32 dstOffset =
+            InOutPixels.AddUninitialized(mipWidth * mipHeight * 4);
+        const uint8* src = InOutPixels.GetData() + srcOffset;
+        uint8* dst = InOutPixels.GetData() + dstOffset;
+
+        for (uint32_t y = 0; y < mipHeight; ++y)
+        {
+            const uint32_t rows[2] = {FMath::Min(y * 2, height - 1),
+                                      FMath::Min(y * 2 + 1, height - 1)};
+            for (uint32_t x = 0; x < mipWidth; ++x)
+            {
+                const uint32_t columns[2] = {FMath::Min(x * 2, width - 1),
+                                             FMath::Min(x * 2 + 1, width - 1)};
+                uint32_t color[3] = {0, 0, 0};
+                uint32_t alpha = 0;
+                for (const uint32_t row : rows)
+                {
+                    for (const uint32_t column : columns)
+                    {
+                        const uint8* texel = src + (row * width + column) * 4;
+                        color[0] += texel[0] * texel[3];
+                        color[1] += texel[1] * texel[3];
+                        color[2] += texel[2] * texel[3];
+                        alpha += texel[3];
+                    }
+                }
+
+                uint8* mipTexel = dst + (y * mipWidth + x) * 4;
+                for (int32 channel = 0; channel < 3; ++channel)
+                {
+                    mipTexel[channel] =
+                        alpha > 0 ? (color[channel] + alpha / 2) / alpha : 0;
+                }
+                mipTexel[3] = (alpha + 2) / 4;
+            }
+        }
+
+        srcOffset = dstOffset;
+        width = mipWidth;
+        height = mipHeight;
+        ++mipLevelCount;
+    }
+    return mipLevelCount;
+}
+
+/**
+ * Image texture. imageData holds mipLevelCount tightly packed 4 bytes per
+ * pixel mips, largest first.
+ */
 class TextureRHIImpl : public Texture
 {
 public:
@@ -396,24 +575,18 @@ public:
                    uint32_t mipLevelCount,
                    const uint8_t* imageData,
                    EPixelFormat PixelFormat = PF_B8G8R8A8) :
-        Texture(width, height)
+        Texture(width, height),
+        m_sizeInBytes(GetMipChainSizeInBytes(width, height, mipLevelCount)),
+        m_mipSizeInBytes(m_sizeInBytes -
+                         GetMipChainSizeInBytes(width, height, 1))
     {
-        FRHIAsyncCommandList commandList;
-        FRHICommandListScopedPipelineGuard Guard(*commandList);
-
-        auto Desc =
-            FRHITextureCreateDesc::Create2D(TEXT("rive.PLSTextureRHIImpl_"),
-                                            m_width,
-                                            m_height,
-                                            PixelFormat);
-        Desc.SetNumMips(mipLevelCount);
-        m_texture = CREATE_TEXTURE_ASYNC(commandList, Desc);
-        commandList->UpdateTexture2D(
-            m_texture,
-            0,
-            FUpdateTextureRegion2D(0, 0, 0, 0, m_width, m_height),
-            m_width * 4,
-            imageData);
+        m_texture = CreateTexture(m_width,
+                                  m_height,
+                                  mipLevelCount,
+                                  imageData,
+                                  PixelFormat);
+        INC_MEMORY_STAT_BY(STAT_RiveImageTextureMemory, m_sizeInBytes);
+        INC_MEMORY_STAT_BY(STAT_RiveImageMipMemory, m_mipSizeInBytes);
     }
 
     TextureRHIImpl(uint32_t width,
@@ -421,25 +594,20 @@ public:
                    uint32_t mipLevelCount,
                    const TArray<uint8>& imageData,
                    EPixelFormat PixelFormat = PF_B8G8R8A8) :
-        Texture(width, height)
-    {
-        FRHIAsyncCommandList commandList;
-        FRHICommandListScopedPipelineGuard Guard(*commandList);
-        // TODO: Move to Staging Buffer
-        auto Desc =
-            FRHITextureCreateDesc::Create2D(TEXT("rive.PLSTextureRHIImpl_"),
-                                            m_width,
-                                            m_height,
-                                            PixelFormat);
-        Desc.SetNumMips(mipLevelCount);
-        m_texture = CREATE_TEXTURE_ASYNC(commandList, Desc);
-        commandList->UpdateTexture2D(
-            m_texture,
-            0,
-            FUpdateTextureRegion2D(0, 0, 0, 0, m_width, m_height),
-            m_width * 4,
-            imageData.GetData());
-    }
+        TextureRHIImpl(width,
+                       height,
+                       mipLevelCount,
+                       imageData.GetData(),
+                       PixelFormat)
+    {}
+
+    /** Samples InTexture as is, its memory is accounted for by its owner */
+    explicit TextureRHIImpl(const FTextureRHIRef& InTexture) :
+        Texture(InTexture->GetSizeX(), InTexture->GetSizeY()),
+        m_texture(InTexture),
+        m_sizeInBytes(0),
+        m_mipSizeInBytes(0)
+    {}
 
     FRDGTextureRef asRDGTexture(FRDGBuilder& Builder) const
     {
@@ -448,86 +616,118 @@ public:
             CreateRenderTarget(m_texture, TEXT("rive.PLSTextureRHIImpl_")));
     }
 
-    virtual ~TextureRHIImpl() override {}
+    virtual ~TextureRHIImpl() override
+    {
+        DEC_MEMORY_STAT_BY(STAT_RiveImageTextureMemory, m_sizeInBytes);
+        DEC_MEMORY_STAT_BY(STAT_RiveImageMipMemory, m_mipSizeInBytes);
+    }
 
     FTextureRHIRef contents() const { return m_texture; }
 
 private:
-    FTextureRHIRef m_texture;
-};
-#else // UE VERSION > 5_5:
-// FRHIAsyncCommandList was removed in 5.5 we should probably defer load these
-// instead but this works for now
-class TextureRHIImpl : public Texture
-{
-public:
-    TextureRHIImpl(uint32_t width,
-                   uint32_t height,
-                   uint32_t mipLevelCount,
-                   const uint8_t* imageData,
-                   EPixelFormat PixelFormat = PF_B8G8R8A8) :
-        Texture(width, height)
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+    static FTextureRHIRef CreateTexture(uint32_t width,
+                                        uint32_t height,
+                                        uint32_t mipLevelCount,
+                                        const uint8_t* imageData,
+                                        EPixelFormat PixelFormat)
     {
-        FRHICommandList& commandList =
-            GRHICommandList.GetImmediateCommandList();
-        FRHICommandListScopedPipelineGuard Guard(commandList);
-
+        FRHIAsyncCommandList commandList;
+        FRHICommandListScopedPipelineGuard Guard(*commandList);
+        // TODO: Move to Staging Buffer
         auto Desc =
             FRHITextureCreateDesc::Create2D(TEXT("rive.PLSTextureRHIImpl_"),
-                                            m_width,
-                                            m_height,
+                                            width,
+                                            height,
                                             PixelFormat);
         Desc.SetNumMips(mipLevelCount);
-        m_texture = CREATE_TEXTURE_ASYNC(commandList, Desc);
-        commandList.UpdateTexture2D(
-            m_texture,
-            0,
-            FUpdateTextureRegion2D(0, 0, 0, 0, m_width, m_height),
-            m_width * 4,
-            imageData);
+        FTextureRHIRef Texture = CREATE_TEXTURE_ASYNC(commandList, Desc);
+        for (uint32_t mip = 0; mip < mipLevelCount; ++mip)
+        {
+            const uint32_t mipWidth = GetMipDimension(width, mip);
+            const uint32_t mipHeight = GetMipDimension(height, mip);
+            commandList->UpdateTexture2D(
+                Texture,
+                mip,
+                FUpdateTextureRegion2D(0, 0, 0, 0, mipWidth, mipHeight),
+                mipWidth * 4,
+                imageData);
+            imageData += mipWidth * mipHeight * 4;
+        }
+        return Texture;
     }
-
-    TextureRHIImpl(uint32_t width,
-                   uint32_t height,
-                   uint32_t mipLevelCount,
-                   const TArray<uint8>& imageData,
-                   EPixelFormat PixelFormat = PF_B8G8R8A8) :
-        Texture(width, height)
+#else // UE VERSION > 5_5:
+    // FRHIAsyncCommandList was removed in 5.5. Textures are created with their
+    // data in a single async call where the RHI supports it, which lets images
+    // be decoded from several worker threads at once. Otherwise they go
+    // through the immediate command list, and FRiveRendererRHI decodes images
+    // on a single thread.
+    static FTextureRHIRef CreateTexture(uint32_t width,
+                                        uint32_t height,
+                                        uint32_t mipLevelCount,
+                                        const uint8_t* imageData,
+                                        EPixelFormat PixelFormat)
     {
+        if (GRHISupportsAsyncTextureCreation)
+        {
+            void* MipData[MAX_TEXTURE_MIP_COUNT];
+            const uint8_t* mipData = imageData;
+            for (uint32_t mip = 0; mip < mipLevelCount; ++mip)
+            {
+                MipData[mip] = const_cast<uint8_t*>(mipData);
+                mipData += GetMipDimension(width, mip) *
+                           GetMipDimension(height, mip) * 4;
+            }
+            FGraphEventRef CompletionEvent;
+            FTextureRHIRef Texture =
+                RHIAsyncCreateTexture2D(width,
+                                        height,
+                                        PixelFormat,
+                                        mipLevelCount,
+                                        ETextureCreateFlags::ShaderResource,
+                                        ERHIAccess::SRVMask,
+                                        MipData,
+                                        mipLevelCount,
+                                        TEXT("rive.PLSTextureRHIImpl_"),
+                                        CompletionEvent);
+            if (CompletionEvent.IsValid())
+            {
+                CompletionEvent->Wait();
+            }
+            return Texture;
+        }
+
         FRHICommandList& commandList =
             GRHICommandList.GetImmediateCommandList();
         FRHICommandListScopedPipelineGuard Guard(commandList);
         // TODO: Move to Staging Buffer
         auto Desc =
             FRHITextureCreateDesc::Create2D(TEXT("rive.PLSTextureRHIImpl_"),
-                                            m_width,
-                                            m_height,
+                                            width,
+                                            height,
                                             PixelFormat);
         Desc.SetNumMips(mipLevelCount);
-        m_texture = CREATE_TEXTURE_ASYNC(commandList, Desc);
-        commandList.UpdateTexture2D(
-            m_texture,
-            0,
-            FUpdateTextureRegion2D(0, 0, 0, 0, m_width, m_height),
-            m_width * 4,
-            imageData.GetData());
-    }
-
-    FRDGTextureRef asRDGTexture(FRDGBuilder& Builder) const
-    {
-        check(m_texture);
-        return Builder.RegisterExternalTexture(
-            CreateRenderTarget(m_texture, TEXT("rive.PLSTextureRHIImpl_")));
+        FTextureRHIRef Texture = CREATE_TEXTURE_ASYNC(commandList, Desc);
+        for (uint32_t mip = 0; mip < mipLevelCount; ++mip)
+        {
+            const uint32_t mipWidth = GetMipDimension(width, mip);
+            const uint32_t mipHeight = GetMipDimension(height, mip);
+            commandList.UpdateTexture2D(
+                Texture,
+                mip,
+                FUpdateTextureRegion2D(0, 0, 0, 0, mipWidth, mipHeight),
+                mipWidth * 4,
+                imageData);
+            imageData += mipWidth * mipHeight * 4;
+        }
+        return Texture;
     }
+#endif
 
-    virtual ~TextureRHIImpl() override {}
-
-    FTextureRHIRef contents() const { return m_texture; }
-
-private:
     FTextureRHIRef m_texture;
+    uint64 m_sizeInBytes;
+    uint64 m_mipSizeInBytes;
 };
-#endif
 
 FString RHICapabilities::AsString() const
 {
@@ -776,7 +976,8 @@ RenderContextRHIImpl::RenderContextRHIImpl(
                                          1,
                                          0,
                                          SCF_Never>::GetRHI();
-    m_mipmapSampler = TStaticSamplerState<SF_Point,
+    // Decoded images have a full mip chain, see r.rive.imagemips
+    m_mipmapSampler = TStaticSamplerState<SF_Trilinear,
                                           AM_Clamp,
                                           AM_Clamp,
                                           AM_Clamp,
@@ -918,10 +1119,10 @@ rcp<Texture> RenderContextRHIImpl::decodeImageTexture(
             return nullptr;
         }
 
-        return make_rcp<TextureRHIImpl>(ImageWrapper->GetWidth(),
-                                        ImageWrapper->GetHeight(),
-                                        1,
-                                        UncompressedBGRA);
+        return makeImageTexture(ImageWrapper->GetWidth(),
+                                ImageWrapper->GetHeight(),
+                                MoveTemp(UncompressedBGRA),
+                                PF_B8G8R8A8);
     }
     else
     {
@@ -934,17 +1135,41 @@ rcp<Texture> RenderContextRHIImpl::decodeImageTexture(
             return nullptr;
         }
 
-        EPixelFormat PixelFormat = EPixelFormat::PF_R8G8B8A8;
         check(bitmap->pixelFormat() == Bitmap::PixelFormat::RGBA);
 
-        return make_rcp<TextureRHIImpl>(bitmap->width(),
-                                        bitmap->height(),
-                                        1,
-                                        bitmap->bytes(),
-                                        EPixelFormat::PF_R8G8B8A8);
+        return makeImageTexture(
+            bitmap->width(),
+            bitmap->height(),
+            TArray<uint8>(bitmap->bytes(),
+                          bitmap->width() * bitmap->height() * 4),
+            PF_R8G8B8A8);
     }
 }
 
+rcp<Texture> RenderContextRHIImpl::makeImageTexture(uint32_t width,
+                                                    uint32_t height,
+                                                    TArray<uint8> imageData,
+                                                    EPixelFormat PixelFormat)
+{
+    check(imageData.Num() == static_cast<int64>(width) * height * 4);
+    const uint32_t mipLevelCount =
+        CVarImageMips.GetValueOnAnyThread() != 0
+            ? AppendImageMips(width, height, imageData)
+            : 1;
+    return make_rcp<TextureRHIImpl>(width,
+                                    height,
+                                    mipLevelCount,
+                                    imageData,
+                                    PixelFormat);
+}
+
+rcp<Texture> RenderContextRHIImpl::adoptImageTexture(
+    const FTextureRHIRef& InTexture)
+{
+    check(InTexture);
+    return make_rcp<TextureRHIImpl>(InTexture);
+}
+
 void RenderContextRHIImpl::resizeFlushUniformBuffer(size_t sizeInBytes)
 {
     m_flushUniformBuffer.reset();
@@ -1195,6 +1420,7 @@ DECLARE_GPU_STAT_NAMED(STAT_RiveFlush_RiveFlushRenderPass,
 void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
 {
     check(IsInRenderingThread());
+    RIVE_TRACE_SCOPE(RiveLogicalFlush);
 
     auto renderTarget = static_cast<RenderTargetRHI*>(desc.renderTarget);
     check(renderTarget);
@@ -1202,7 +1428,21 @@ void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
     FRHICommandList& CommandList = GRHICommandList.GetImmediateCommandList();
     auto ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
 
-    FRDGBuilder GraphBuilder(CommandList.GetAsImmediate());
+    if (m_isBatching && !m_batchGraphBuilder)
+    {
+        m_batchGraphBuilder = MakeUnique<FRDGBuilder>(
+            CommandList.GetAsImmediate(),
+            RDG_EVENT_NAME("RiveBatchedFlush"));
+    }
+
+    TOptional<FRDGBuilder> LocalGraphBuilder;
+    if (!m_batchGraphBuilder)
+    {
+        LocalGraphBuilder.Emplace(CommandList.GetAsImmediate());
+    }
+    FRDGBuilder& GraphBuilder = m_batchGraphBuilder
+                                    ? *m_batchGraphBuilder
+                                    : LocalGraphBuilder.GetValue();
     {
         RDG_GPU_STAT_SCOPE(GraphBuilder, STAT_RiveFlush);
 
@@ -1265,24 +1505,28 @@ void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
         {
             pathSRV = m_pathBuffer.SyncSRV(GraphBuilder,
                                            desc.firstPath,
-                                           desc.pathCount);
+                                           desc.pathCount,
+                                           GetUploadDataFlags());
             paintSRV = m_paintBuffer.SyncSRV(GraphBuilder,
                                              desc.firstPaint,
-                                             desc.pathCount);
+                                             desc.pathCount,
+                                             GetUploadDataFlags());
             paintAuxSRV = m_paintAuxBuffer.SyncSRV(GraphBuilder,
                                                    desc.firstPaintAux,
-                                                   desc.pathCount);
+                                                   desc.pathCount,
+                                                   GetUploadDataFlags());
         }
 
         if (desc.contourCount > 0)
         {
             contourSRV = m_contourBuffer.SyncSRV(GraphBuilder,
                                                  desc.firstContour,
-                                                 desc.contourCount);
+                                                 desc.contourCount,
+                                                 GetUploadDataFlags());
         }
 
         FBufferRHIRef triangleBuffer = nullptr;
-        // TODO: only sync on first flush of frame
+        // Only uploads on the first flush of the frame
         if (m_triangleBuffer)
         {
             triangleBuffer = m_triangleBuffer->Sync(CommandList);
@@ -1314,15 +1558,14 @@ void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
 
             check(gradiantTexture);
             check(m_gradSpanBuffer);
-            auto gradSpanBuffer = m_gradSpanBuffer->Sync(
-                CommandList,
-                desc.firstGradSpan * sizeof(GradientSpan));
+            auto gradSpanBuffer = m_gradSpanBuffer->Sync(CommandList);
             AddGradientPass(GraphBuilder,
                             flushUniforms,
                             VertexDeclarations[static_cast<int>(
                                 EVertexDeclarations::Gradient)],
                             gradiantTexture,
                             gradSpanBuffer,
+                            desc.firstGradSpan * sizeof(GradientSpan),
                             FUint32Rect({0, 0},
                                         {
                                             kGradTextureWidth,
@@ -1344,9 +1587,7 @@ void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
             check(pathSRV);
             check(contourSRV);
 
-            auto tessSpanBuffer = m_tessSpanBuffer->Sync(
-                CommandList,
-                desc.firstTessVertexSpan * sizeof(TessVertexSpan));
+            auto tessSpanBuffer = m_tessSpanBuffer->Sync(CommandList);
 
             auto TessPassParams =
                 GraphBuilder.AllocParameters<FRiveTesselationPassParameters>();
@@ -1364,6 +1605,7 @@ void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
                 VertexDeclarations[static_cast<int>(
                     EVertexDeclarations::Tessellation)],
                 tessSpanBuffer,
+                desc.firstTessVertexSpan * sizeof(TessVertexSpan),
                 m_tessSpanIndexBuffer,
                 {{0, 0}, {kTessTextureWidth, desc.tessDataHeight}},
                 desc.tessVertexSpanCount,
@@ -1786,5 +2028,43 @@ void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
         }
     } // End Flush Event Scope
 
-    GraphBuilder.Execute();
+#if RIVE_TRACE_ENABLED
+    uint32 DrawCount = 0;
+    if (UE_TRACE_CHANNELEXPR_IS_ENABLED(RiveChannel))
+    {
+        for (const DrawBatch& batch : *desc.drawList)
+        {
+            DrawCount += batch.elementCount != 0;
+        }
+    }
+    UE::Rive::Trace::CountLogicalFlush(
+        DrawCount,
+        desc.pathCount,
+        static_cast<uint32>(desc.tessDataHeight * kTessTextureWidth),
+        desc.gradSpanCount);
+#endif // RIVE_TRACE_ENABLED
+
+    if (LocalGraphBuilder)
+    {
+        GraphBuilder.Execute();
+    }
+}
+
+void RenderContextRHIImpl::BeginBatchedGraph()
+{
+    check(IsInRenderingThread());
+
+    m_isBatching = CVarBatchFrameGraph.GetValueOnRenderThread() != 0;
+}
+
+void RenderContextRHIImpl::ExecuteBatchedGraph()
+{
+    check(IsInRenderingThread());
+
+    m_isBatching = false;
+    if (m_batchGraphBuilder)
+    {
+        m_batchGraphBuilder->Execute();
+        m_batchGraphBuilder.Reset();
+    }
 }
@@ -3,6 +3,7 @@
 
 #include "RenderGraphBuilder.h"
 #include "Logs/RiveRendererLog.h"
+#include "RiveStats.h"
 #include <RiveShaders/Public/RiveShaderTypes.h>
 
 THIRD_PARTY_INCLUDES_START
@@ -65,9 +66,20 @@ public:
                       size_t InSizeInBytes,
                       size_t stride);
 
-    FBufferRHIRef Sync(FRHICommandList& commandList,
+    /**
+     * Returns a persistent buffer holding everything mapped this frame. It is
+     * uploaded on the first Sync after mapping only, so flushes bind it at
+     * their own offset instead of getting a buffer each.
+     */
+    FBufferRHIRef Sync(FRHICommandList& commandList) const;
+    /**
+     * Uploads what was mapped from offsetInBytes into a graph buffer.
+     * InitialDataFlags must copy the data if the graph executes after the
+     * ring is mapped again.
+     */
+    FRDGBufferRef Sync(FRDGBuilder& RDGBuilder,
+                       ERDGInitialDataFlags InitialDataFlags,
                        size_t offsetInBytes = 0) const;
-    FRDGBufferRef Sync(FRDGBuilder& RDGBuilder, size_t offsetInBytes = 0) const;
 
 protected:
     virtual void* onMapBuffer(int bufferIdx, size_t mapSizeInBytes) override;
@@ -75,8 +87,34 @@ protected:
                                         size_t mapSizeInBytes) override;
 
 private:
+    /** Bytes from offsetInBytes to the end of what was mapped last */
+    size_t UploadSizeInBytes(size_t offsetInBytes) const;
+
+    /**
+     * Index of a pooled buffer of at least sizeInBytes the GPU is done with,
+     * creating or regrowing one if needed
+     */
+    int32 AcquirePooledBuffer(FRHICommandList& commandList,
+                              size_t sizeInBytes) const;
+
+    struct FPooledBuffer
+    {
+        FBufferRHIRef Buffer;
+        size_t SizeInBytes = 0;
+        uint32 LastUsedFrame = 0;
+    };
+
+    /** Frames a buffer stays untouched after its last use before reuse */
+    static constexpr uint32 kFramesInFlight = 3;
+
     EBufferUsageFlags m_flags;
     size_t m_stride;
+    size_t m_writtenSizeInBytes = 0;
+
+    mutable TArray<FPooledBuffer, TInlineAllocator<kFramesInFlight + 1>>
+        m_pooledBuffers;
+    /** Pooled buffer holding the mapped data, INDEX_NONE until synced */
+    mutable int32 m_syncedBufferIndex = INDEX_NONE;
 };
 
 template <typename UniformBufferType>
@@ -88,8 +126,12 @@ public:
     TRDGUniformBufferRef<UniformBufferType> Sync(FRDGBuilder& Builder,
                                                  size_t offset)
     {
+        // RDG reads the parameters when the graph executes, which may be after
+        // the shadow buffer was rewritten for another flush, so copy them
         UniformBufferType* Buffer =
-            reinterpret_cast<UniformBufferType*>(shadowBuffer() + offset);
+            Builder.AllocParameters<UniformBufferType>();
+        *Buffer =
+            *reinterpret_cast<UniformBufferType*>(shadowBuffer() + offset);
         return Builder.CreateUniformBuffer<UniformBufferType>(Buffer);
     }
 
@@ -153,13 +195,19 @@ public:
         m_sizeInBytes = newSizeInBytes;
     }
 
+    /** See BufferRingRHIImpl::Sync for InitialDataFlags */
     FRDGBufferSRVRef SyncSRV(FRDGBuilder& Builder,
                              size_t elementOffset,
-                             size_t elementCount)
+                             size_t elementCount,
+                             ERDGInitialDataFlags InitialDataFlags)
     {
         if (m_sizeInBytes == 0)
             return nullptr;
 
+        // Only the elements mapped this frame were written
+        check((elementOffset + elementCount) * m_cpuStride <=
+              m_lastMapSizeInBytes);
+
         auto buffer = Builder.CreateBuffer(
             FRDGBufferDesc::CreateStructuredDesc(
                 m_gpuStride,
@@ -170,7 +218,8 @@ public:
         Builder.QueueBufferUpload(buffer,
                                   &m_data[elementOffset],
                                   m_cpuStride * elementCount,
-                                  ERDGInitialDataFlags::None);
+                                  InitialDataFlags);
+        INC_DWORD_STAT_BY(STAT_RiveBytesUploaded, m_cpuStride * elementCount);
 
         return Builder.CreateSRV(FRDGBufferSRVDesc(buffer));
     }
@@ -258,6 +307,19 @@ public:
     virtual rive::rcp<rive::gpu::Texture> decodeImageTexture(
         rive::Span<const uint8_t> encodedBytes) override;
 
+    /**
+     * Image texture from raw 4 bytes per pixel data, with the same mips as
+     * decoded images
+     */
+    rive::rcp<rive::gpu::Texture> makeImageTexture(uint32_t width,
+                                                   uint32_t height,
+                                                   TArray<uint8> imageData,
+                                                   EPixelFormat PixelFormat);
+
+    /** Image texture sampling InTexture directly, without a copy */
+    rive::rcp<rive::gpu::Texture> adoptImageTexture(
+        const FTextureRHIRef& InTexture);
+
     virtual void resizeFlushUniformBuffer(size_t sizeInBytes) override;
     virtual void resizeImageDrawUniformBuffer(size_t sizeInBytes) override;
     virtual void resizePathBuffer(size_t sizeInBytes,
@@ -306,7 +368,37 @@ public:
 
     virtual void flush(const rive::gpu::FlushDescriptor&) override;
 
+    /**
+     * Records the following flushes into one graph until ExecuteBatchedGraph,
+     * if r.rive.batchframegraph is set
+     */
+    void BeginBatchedGraph();
+
+    /**
+     * Executes the flushes recorded into the batched graph since
+     * BeginBatchedGraph, if any, and stops batching
+     */
+    void ExecuteBatchedGraph();
+
 private:
+    /**
+     * A batched graph executes after the shadow buffers were rewritten for
+     * other flushes, so only its uploads need a copy of the data
+     */
+    ERDGInitialDataFlags GetUploadDataFlags() const
+    {
+        return m_batchGraphBuilder ? ERDGInitialDataFlags::None
+                                   : ERDGInitialDataFlags::NoCopy;
+    }
+
+    /**
+     * Graph every flush of the frame is recorded into when batching, so the
+     * render targets share one upload phase and one Execute
+     */
+    TUniquePtr<FRDGBuilder> m_batchGraphBuilder;
+    /** Between BeginBatchedGraph and ExecuteBatchedGraph */
+    bool m_isBatching = false;
+
     DelayLoadedTexture m_gradientTexture;
     DelayLoadedTexture m_tesselationTexture;
     DelayLoadedTexture m_featherAtlasTexture;
@@ -84,7 +84,7 @@ void FRiveRenderTargetD3D11::CacheTextureTarget_RenderThread(
 
 void FRiveRenderTargetD3D11::Render_RenderThread(
     FRHICommandListImmediate& RHICmdList,
-    const TArray<FRiveRenderCommand>& RiveRenderCommands)
+    const FRiveRenderCommandBuffer& InCommandBuffer)
 {
     // First, we transition the texture to a RenderTextureView
     FTextureRHIRef TargetTexture = RenderTarget->GetResource()->TextureRHI;
@@ -92,11 +92,12 @@ void FRiveRenderTargetD3D11::Render_RenderThread(
                                              ERHIAccess::Unknown,
                                              ERHIAccess::RTV));
     // Then we render Rive, ensuring the DX11 states are reset before and after
-    // the call
+    // the call. The buffer stays alive until Render_Internal releases it
     RHICmdList.EnqueueLambda(
-        [this, RiveRenderCommands](FRHICommandListImmediate& RHICmdList) {
+        [this, CommandBuffer = &InCommandBuffer](
+            FRHICommandListImmediate& RHICmdList) {
             RiveRendererD3D11->ResetDXState();
-            FRiveRenderTarget::Render_Internal(RiveRenderCommands);
+            FRiveRenderTarget::Render_Internal(*CommandBuffer);
             RiveRendererD3D11->ResetDXState();
         });
     // Finally we transition the texture to a UAV Graphics
@@ -0,0 +1,134 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRenderTargetNull.h"
+
+#include "Engine/Texture2DDynamic.h"
+#include "Misc/ScopeExit.h"
+#include "RenderingThread.h"
+#include "RiveRendererNull.h"
+#include "RiveScopeLock.h"
+#include "RiveStats.h"
+#include "RiveTrace.h"
+#include "TextureResource.h"
+
+#if WITH_RIVE
+THIRD_PARTY_INCLUDES_START
+#include "utils/no_op_renderer.hpp"
+THIRD_PARTY_INCLUDES_END
+#endif // WITH_RIVE
+
+FRiveRenderTargetNull::FRiveRenderTargetNull(
+    const TSharedRef<FRiveRendererNull>& InRiveRenderer,
+    const FName& InRiveName,
+    UTexture2DDynamic* InRenderTarget) :
+    FRiveRenderTarget(InRiveRenderer, InRiveName, InRenderTarget),
+    bSoftware(InRiveRenderer->IsSoftware())
+{}
+
+FRiveRenderTargetNull::~FRiveRenderTargetNull() {}
+
+#if WITH_RIVE
+
+void FRiveRenderTargetNull::RegisterRenderCommand(
+    RiveRenderFunction RenderFunction)
+{
+    bHasSubmitted = false;
+    ENQUEUE_RENDER_COMMAND(FRiveRenderTargetNull_CustomRenderCommand)
+    ([this, RenderFunction = std::move(RenderFunction)](
+         FRHICommandListImmediate& RHICmdList) {
+        FRiveScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+        if (!bSoftware)
+        {
+            rive::NoOpRenderer Renderer;
+            RenderFunction(RiveRenderer->GetFactory(), &Renderer);
+            return;
+        }
+
+        Canvas.Resize(GetWidth_RenderThread(), GetHeight_RenderThread());
+        FRiveSoftwareRenderer Renderer(Canvas);
+        RenderFunction(RiveRenderer->GetFactory(), &Renderer);
+        Renderer.Flush();
+        UploadCanvas_RenderThread(RHICmdList);
+    });
+}
+
+void FRiveRenderTargetNull::Render_Internal(
+    const FRiveRenderCommandBuffer& InCommandBuffer)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRiveRenderTargetNull::Render"),
+                                STAT_FRiveRenderTargetNull_Render,
+                                STATGROUP_Rive);
+    RIVE_TRACE_SCOPE_TEXT(RiveName.ToString());
+
+    ON_SCOPE_EXIT { InCommandBuffer.MarkReleased(); };
+
+    if (!bSoftware)
+    {
+        // Artboards are still drawn, which is the CPU cost being measured
+        // when running headless
+        rive::NoOpRenderer Renderer;
+        DrawCommands(Renderer, InCommandBuffer);
+        return;
+    }
+
+    // Like the GPU targets, every frame starts from the clear color
+    Canvas.Resize(GetWidth_RenderThread(), GetHeight_RenderThread());
+    Canvas.Clear(ClearColor);
+    bIsCleared = true;
+
+    FRiveSoftwareRenderer Renderer(Canvas);
+    DrawCommands(Renderer, InCommandBuffer);
+    Renderer.Flush();
+    UploadCanvas_RenderThread(FRHICommandListImmediate::Get());
+}
+
+void FRiveRenderTargetNull::UploadCanvas_RenderThread(
+    FRHICommandListImmediate& RHICmdList)
+{
+    check(IsInRenderingThread());
+
+    // The Null RHI has no textures, they only exist when r.rive.software
+    // selects the software renderer on a real RHI
+    FTextureResource* Resource =
+        RenderTarget ? RenderTarget->GetResource() : nullptr;
+    if (Resource == nullptr || !Resource->TextureRHI ||
+        Canvas.GetWidth() == 0 || Canvas.GetHeight() == 0)
+    {
+        return;
+    }
+
+    const FTextureRHIRef& Texture = Resource->TextureRHI;
+    const EPixelFormat Format = Texture->GetFormat();
+    const FIntPoint Extent = Texture->GetSizeXY();
+    if ((Format != PF_R8G8B8A8 && Format != PF_B8G8R8A8) ||
+        Extent.X != Canvas.GetWidth() || Extent.Y != Canvas.GetHeight())
+    {
+        return;
+    }
+
+    TArray<FColor> Pixels;
+    Canvas.ReadPixels(Pixels);
+    if (Format == PF_R8G8B8A8)
+    {
+        // FColor is laid out as BGRA
+        for (FColor& Pixel : Pixels)
+        {
+            Swap(Pixel.R, Pixel.B);
+        }
+    }
+
+    const FUpdateTextureRegion2D Region(0,
+                                        0,
+                                        0,
+                                        0,
+                                        Canvas.GetWidth(),
+                                        Canvas.GetHeight());
+    RHICmdList.UpdateTexture2D(
+        Texture,
+        0,
+        Region,
+        Canvas.GetWidth() * sizeof(FColor),
+        reinterpret_cast<const uint8*>(Pixels.GetData()));
+}
+
+#endif // WITH_RIVE
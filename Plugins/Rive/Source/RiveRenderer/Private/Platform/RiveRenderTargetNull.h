@@ -0,0 +1,59 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "RiveRenderTarget.h"
+#include "RiveSoftwareRenderer.h"
+
+class FRiveRendererNull;
+
+/**
+ * Render target of FRiveRendererNull, replays the recorded commands on a
+ * no-op renderer, or on the software renderer which then uploads its pixels
+ * to the texture when there is one
+ */
+class FRiveRenderTargetNull final : public FRiveRenderTarget
+{
+public:
+    /**
+     * Structor(s)
+     */
+
+    FRiveRenderTargetNull(const TSharedRef<FRiveRendererNull>& InRiveRenderer,
+                          const FName& InRiveName,
+                          UTexture2DDynamic* InRenderTarget);
+    virtual ~FRiveRenderTargetNull() override;
+
+    //~ BEGIN : IRiveRenderTarget Interface
+public:
+    /** There is no GPU texture to cache */
+    virtual void Initialize() override { bHasSubmitted = false; }
+
+#if WITH_RIVE
+    virtual void RegisterRenderCommand(
+        RiveRenderFunction RenderFunction) override;
+#endif // WITH_RIVE
+    //~ END : IRiveRenderTarget Interface
+
+#if WITH_RIVE
+    //~ BEGIN : FRiveRenderTarget Interface
+protected:
+    virtual void Render_Internal(
+        const FRiveRenderCommandBuffer& InCommandBuffer) override;
+    virtual rive::rcp<rive::gpu::RenderTarget> GetRenderTarget() const override
+    {
+        return nullptr;
+    }
+    //~ END : FRiveRenderTarget Interface
+
+private:
+    /** Copies the canvas to the texture resource, if it has one */
+    void UploadCanvas_RenderThread(FRHICommandListImmediate& RHICmdList);
+
+    FRiveSoftwareCanvas Canvas;
+#endif // WITH_RIVE
+
+private:
+    /** FRiveRendererNull::IsSoftware when the target was created */
+    const bool bSoftware;
+};
@@ -86,18 +86,19 @@ void FRiveRenderTargetOpenGL::CacheTextureTarget_RenderThread(
     }
 }
 
-void FRiveRenderTargetOpenGL::Submit()
+void FRiveRenderTargetOpenGL::Submit_Internal(
+    const FRiveRenderCommandBuffer& InCommandBuffer)
 {
     RIVE_DEBUG_FUNCTION_INDENT;
     check(IsInGameThread());
 
     if (IRiveRendererModule::RunInGameThread())
     {
-        Render_Internal(RenderCommands);
+        Render_Internal(InCommandBuffer);
     }
     else
     {
-        FRiveRenderTarget::Submit();
+        FRiveRenderTarget::Submit_Internal(InCommandBuffer);
     }
 }
 
@@ -189,14 +190,15 @@ void FRiveRenderTargetOpenGL::EndFrame() const
 
 void FRiveRenderTargetOpenGL::Render_RenderThread(
     FRHICommandListImmediate& RHICmdList,
-    const TArray<FRiveRenderCommand>& RiveRenderCommands)
+    const FRiveRenderCommandBuffer& InCommandBuffer)
 {
     RIVE_DEBUG_FUNCTION_INDENT;
     check(IsInRenderingThread());
 
-    RHICmdList.EnqueueLambda([this, RiveRenderCommands = RiveRenderCommands](
+    // The buffer stays alive until Render_Internal releases it
+    RHICmdList.EnqueueLambda([this, CommandBuffer = &InCommandBuffer](
                                  FRHICommandListImmediate& RHICmdList) {
-        Render_Internal(RiveRenderCommands);
+        Render_Internal(*CommandBuffer);
     });
 }
 
@@ -43,16 +43,17 @@ public:
     //~ END : IRiveRenderTarget Interface
 
     //~ BEGIN : FRiveRenderTarget Interface
-    virtual void Submit() override;
 
 protected:
+    virtual void Submit_Internal(
+        const FRiveRenderCommandBuffer& InCommandBuffer) override;
     // It Might need to be on rendering thread, render QUEUE is required
     virtual rive::rcp<rive::gpu::RenderTarget> GetRenderTarget() const override;
     virtual std::unique_ptr<rive::RiveRenderer> BeginFrame() override;
     virtual void EndFrame() const override;
     virtual void Render_RenderThread(
         FRHICommandListImmediate& RHICmdList,
-        const TArray<FRiveRenderCommand>& RiveRenderCommands) override;
+        const FRiveRenderCommandBuffer& InCommandBuffer) override;
     //~ END : FRiveRenderTarget Interface
 
 private:
@@ -64,9 +64,9 @@ void FRiveRenderTargetRHI::CacheTextureTarget_RenderThread(
 
 void FRiveRenderTargetRHI::Render_RenderThread(
     FRHICommandListImmediate& RHICmdList,
-    const TArray<FRiveRenderCommand>& RiveRenderCommands)
+    const FRiveRenderCommandBuffer& InCommandBuffer)
 {
-    FRiveRenderTarget::Render_Internal(RiveRenderCommands);
+    FRiveRenderTarget::Render_Internal(InCommandBuffer);
 }
 
 rive::rcp<rive::gpu::RenderTarget> FRiveRenderTargetRHI::GetRenderTarget() const
@@ -24,7 +24,7 @@ protected:
     // It Might need to be on rendering thread, render QUEUE is required
     virtual void Render_RenderThread(
         FRHICommandListImmediate& RHICmdList,
-        const TArray<FRiveRenderCommand>& RiveRenderCommands) override;
+        const FRiveRenderCommandBuffer& InCommandBuffer) override;
     virtual rive::rcp<rive::gpu::RenderTarget> GetRenderTarget() const override;
     //~ END : FRiveRenderTarget Interface
 #endif // WITH_RIVE
@@ -0,0 +1,100 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRendererNull.h"
+
+#include "RiveRenderTargetNull.h"
+#include "RiveSoftwareRenderer.h"
+
+static TAutoConsoleVariable<bool> CVarHeadlessSoftware(
+    TEXT("r.rive.headless.software"),
+    false,
+    TEXT("If true, the headless renderer used with the Null RHI draws rive "
+         "render targets with the CPU software renderer instead of skipping "
+         "the rasterization. Read when the renderer is created."),
+    ECVF_ReadOnly);
+
+static TAutoConsoleVariable<bool> CVarSoftware(
+    TEXT("r.rive.software"),
+    false,
+    TEXT("If true, rive render targets are drawn by the CPU software renderer "
+         "on any RHI and uploaded to their texture, for reference images or "
+         "GPUs the rive renderer does not support. Read at startup."),
+    ECVF_ReadOnly);
+
+#if WITH_RIVE
+THIRD_PARTY_INCLUDES_START
+#include "utils/no_op_factory.hpp"
+THIRD_PARTY_INCLUDES_END
+#endif // WITH_RIVE
+
+FRiveRendererNull::FRiveRendererNull() :
+    bSoftware(CVarHeadlessSoftware.GetValueOnAnyThread() ||
+              CVarSoftware.GetValueOnAnyThread())
+{}
+
+bool FRiveRendererNull::IsSoftwareForced()
+{
+    return CVarSoftware.GetValueOnAnyThread();
+}
+
+FRiveRendererNull::~FRiveRendererNull() {}
+
+TSharedPtr<IRiveRenderTarget> FRiveRendererNull::CreateTextureTarget_GameThread(
+    const FName& InRiveName,
+    UTexture2DDynamic* InRenderTarget)
+{
+    check(IsInGameThread());
+
+    FScopeLock Lock(&ThreadDataCS);
+
+    const TSharedPtr<FRiveRenderTargetNull> RiveRenderTarget =
+        MakeShared<FRiveRenderTargetNull>(SharedThis(this),
+                                          InRiveName,
+                                          InRenderTarget);
+
+    RenderTargets.Add(InRiveName, RiveRenderTarget);
+
+    return RiveRenderTarget;
+}
+
+void FRiveRendererNull::CreateRenderContext_RenderThread(
+    FRHICommandListImmediate& RHICmdList)
+{
+    FScopeLock Lock(&ThreadDataCS);
+
+#if WITH_RIVE
+    if (bSoftware)
+    {
+        Factory = std::make_unique<FRiveSoftwareFactory>();
+    }
+    else
+    {
+        Factory = std::make_unique<rive::NoOpFactory>();
+    }
+#endif // WITH_RIVE
+}
+
+#if WITH_RIVE
+
+rive::Factory* FRiveRendererNull::GetFactory() { return Factory.get(); }
+
+rive::rcp<rive::RenderImage> FRiveRendererNull::MakeImageFromPixels(
+    uint32 InWidth,
+    uint32 InHeight,
+    TArray<uint8> InPixels,
+    EPixelFormat InPixelFormat)
+{
+    if (!bSoftware)
+    {
+        return FRiveRenderer::MakeImageFromPixels(InWidth,
+                                                  InHeight,
+                                                  MoveTemp(InPixels),
+                                                  InPixelFormat);
+    }
+    return FRiveSoftwareFactory::MakeImage(InWidth,
+                                           InHeight,
+                                           InPixels,
+                                           InPixelFormat);
+}
+
+#endif // WITH_RIVE
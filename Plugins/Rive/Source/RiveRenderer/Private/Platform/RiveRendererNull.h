@@ -0,0 +1,80 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "RiveRenderer.h"
+
+/**
+ * Headless renderer used with the Null RHI (dedicated servers, commandlets,
+ * CI). Files are imported through a no-op factory and render targets still
+ * advance their artboards and walk Artboard::draw, so the CPU side of Rive
+ * can run and be profiled without a GPU. Nothing is drawn, unless
+ * r.rive.headless.software is set: the CPU software renderer then draws into
+ * the targets so headless runs still produce pixels. With r.rive.software it
+ * also replaces the GPU renderers on a real RHI, uploading each canvas to its
+ * target's texture.
+ */
+class RIVERENDERER_API FRiveRendererNull : public FRiveRenderer
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    FRiveRendererNull();
+
+    virtual ~FRiveRendererNull() override;
+
+    //~ BEGIN : IRiveRenderer Interface
+
+public:
+    virtual TSharedPtr<IRiveRenderTarget> CreateTextureTarget_GameThread(
+        const FName& InRiveName,
+        UTexture2DDynamic* InRenderTarget) override;
+
+    virtual void CreateRenderContext_RenderThread(
+        FRHICommandListImmediate& RHICmdList) override;
+
+    /** Neither factory keeps state between calls */
+    virtual bool SupportsParallelImageDecode() const override { return true; }
+
+    virtual bool SupportsRawImagePixels() const override { return bSoftware; }
+
+#if WITH_RIVE
+
+    /** There is no render context to draw with, by design */
+    virtual rive::gpu::RenderContext* GetRenderContext() override
+    {
+        return nullptr;
+    }
+
+    virtual rive::Factory* GetFactory() override;
+
+    virtual rive::rcp<rive::RenderImage> MakeImageFromPixels(
+        uint32 InWidth,
+        uint32 InHeight,
+        TArray<uint8> InPixels,
+        EPixelFormat InPixelFormat) override;
+
+#endif // WITH_RIVE
+
+    //~ END : IRiveRenderer Interface
+
+    /** Whether targets are drawn by the software renderer */
+    bool IsSoftware() const { return bSoftware; }
+
+    /** r.rive.software, which selects this renderer on any RHI */
+    static bool IsSoftwareForced();
+
+    /**
+     * Attribute(s)
+     */
+
+private:
+    /** r.rive.headless.software, read once when the renderer is created */
+    bool bSoftware;
+
+#if WITH_RIVE
+    std::unique_ptr<rive::Factory> Factory;
+#endif // WITH_RIVE
+};
@@ -28,6 +28,8 @@ public:
     virtual void CreateRenderContext_GameThread();
     virtual void CreateRenderContext_RenderThread(
         FRHICommandListImmediate& RHICmdList) override;
+    /** GL textures can only be created where the GL context is current */
+    virtual bool SupportsWorkerThreadDecode() const override { return false; }
     //~ END : IRiveRenderer Interface
 
     virtual rive::gpu::RenderContext* GetOrCreateRenderContext_Internal();
@@ -1,6 +1,130 @@
 #include "RiveRendererRHI.h"
 #include "RenderContextRHIImpl.hpp"
 #include "RiveRenderTargetRHI.h"
+#include "Engine/World.h"
+#include "Misc/EngineVersionComparison.h"
+#include "RHI.h"
+
+FRiveRendererRHI::FRiveRendererRHI()
+{
+    // Render targets are mostly flushed while a world ticks, the batch is
+    // executed before its viewports enqueue their rendering so they sample
+    // this frame's draws. Nothing is batched outside of a world tick.
+    OnWorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddRaw(
+        this,
+        &FRiveRendererRHI::OnWorldTickStart);
+    OnWorldPostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddRaw(
+        this,
+        &FRiveRendererRHI::OnWorldPostActorTick);
+}
+
+FRiveRendererRHI::~FRiveRendererRHI()
+{
+    FWorldDelegates::OnWorldTickStart.Remove(OnWorldTickStartHandle);
+    FWorldDelegates::OnWorldPostActorTick.Remove(OnWorldPostActorTickHandle);
+
+    ENQUEUE_RENDER_COMMAND(FRiveRendererRHI_ExecuteBatchedGraph)
+    ([this](FRHICommandListImmediate& RHICmdList) {
+        ExecuteBatchedGraph_RenderThread();
+    });
+    FlushRenderingCommands();
+}
+
+void FRiveRendererRHI::OnWorldTickStart(UWorld* InWorld,
+                                        ELevelTick InTickType,
+                                        float InDeltaSeconds)
+{
+    ENQUEUE_RENDER_COMMAND(FRiveRendererRHI_BeginBatchedGraph)
+    ([this](FRHICommandListImmediate& RHICmdList) {
+        FScopeLock Lock(&ThreadDataCS);
+#if WITH_RIVE
+        if (RenderContext)
+        {
+            RenderContext->static_impl_cast<RenderContextRHIImpl>()
+                ->BeginBatchedGraph();
+        }
+#endif // WITH_RIVE
+    });
+}
+
+void FRiveRendererRHI::OnWorldPostActorTick(UWorld* InWorld,
+                                            ELevelTick InTickType,
+                                            float InDeltaSeconds)
+{
+    ENQUEUE_RENDER_COMMAND(FRiveRendererRHI_ExecuteBatchedGraph)
+    ([this](FRHICommandListImmediate& RHICmdList) {
+        ExecuteBatchedGraph_RenderThread();
+    });
+}
+
+void FRiveRendererRHI::ExecuteBatchedGraph_RenderThread()
+{
+    check(IsInRenderingThread());
+
+    FScopeLock Lock(&ThreadDataCS);
+
+#if WITH_RIVE
+    if (RenderContext)
+    {
+        RenderContext->static_impl_cast<RenderContextRHIImpl>()
+            ->ExecuteBatchedGraph();
+    }
+#endif // WITH_RIVE
+}
+
+bool FRiveRendererRHI::SupportsWorkerThreadDecode() const
+{
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+    return true;
+#else
+    // Without async texture creation, textures go through the immediate
+    // command list, which can't be used from worker threads
+    return GRHISupportsAsyncTextureCreation;
+#endif
+}
+
+bool FRiveRendererRHI::SupportsParallelImageDecode() const
+{
+    return SupportsWorkerThreadDecode();
+}
+
+#if WITH_RIVE
+
+rive::rcp<rive::RenderImage> FRiveRendererRHI::MakeImageFromPixels(
+    uint32 InWidth,
+    uint32 InHeight,
+    TArray<uint8> InPixels,
+    EPixelFormat InPixelFormat)
+{
+    if (!RenderContext)
+    {
+        return nullptr;
+    }
+
+    rive::rcp<rive::gpu::Texture> Texture =
+        RenderContext->static_impl_cast<RenderContextRHIImpl>()
+            ->makeImageTexture(InWidth,
+                               InHeight,
+                               MoveTemp(InPixels),
+                               InPixelFormat);
+    return rive::make_rcp<rive::RiveRenderImage>(MoveTemp(Texture));
+}
+
+rive::rcp<rive::RenderImage> FRiveRendererRHI::MakeImageFromTexture(
+    const FTextureRHIRef& InTexture)
+{
+    if (!RenderContext || !InTexture)
+    {
+        return nullptr;
+    }
+
+    rive::rcp<rive::gpu::Texture> Texture =
+        RenderContext->static_impl_cast<RenderContextRHIImpl>()
+            ->adoptImageTexture(InTexture);
+    return rive::make_rcp<rive::RiveRenderImage>(MoveTemp(Texture));
+}
+
+#endif // WITH_RIVE
 
 TSharedPtr<IRiveRenderTarget> FRiveRendererRHI::CreateTextureTarget_GameThread(
     const FName& InRiveName,
@@ -1,9 +1,15 @@
 #pragma once
+#include "Engine/EngineBaseTypes.h"
 #include "RiveRenderer.h"
 
+class UWorld;
+
 class RIVERENDERER_API FRiveRendererRHI : public FRiveRenderer
 {
 public:
+    FRiveRendererRHI();
+    virtual ~FRiveRendererRHI() override;
+
     //~ BEGIN : IRiveRenderer Interface
     virtual TSharedPtr<IRiveRenderTarget> CreateTextureTarget_GameThread(
         const FName& InRiveName,
@@ -11,5 +17,35 @@ public:
     virtual void CreateRenderContext_RenderThread(
         FRHICommandListImmediate& RHICmdList) override;
     virtual void Flush(rive::gpu::RenderContext& context) {}
+    /**
+     * Images are decoded by the ImageWrapper module into RHI textures, on
+     * workers and in parallel where those can be created off the render
+     * thread
+     */
+    virtual bool SupportsWorkerThreadDecode() const override;
+    virtual bool SupportsParallelImageDecode() const override;
+    virtual bool SupportsRawImagePixels() const override { return true; }
+    virtual bool SupportsTextureImages() const override { return true; }
+    virtual rive::rcp<rive::RenderImage> MakeImageFromPixels(
+        uint32 InWidth,
+        uint32 InHeight,
+        TArray<uint8> InPixels,
+        EPixelFormat InPixelFormat) override;
+    virtual rive::rcp<rive::RenderImage> MakeImageFromTexture(
+        const FTextureRHIRef& InTexture) override;
     //~ END : IRiveRenderer Interface
+
+private:
+    /** Executes the flushes batched by r.rive.batchframegraph, if any */
+    void ExecuteBatchedGraph_RenderThread();
+
+    void OnWorldTickStart(UWorld* InWorld,
+                          ELevelTick InTickType,
+                          float InDeltaSeconds);
+    void OnWorldPostActorTick(UWorld* InWorld,
+                              ELevelTick InTickType,
+                              float InDeltaSeconds);
+
+    FDelegateHandle OnWorldTickStartHandle;
+    FDelegateHandle OnWorldPostActorTickHandle;
 };
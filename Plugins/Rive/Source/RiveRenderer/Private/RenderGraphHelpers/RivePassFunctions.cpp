@@ -33,6 +33,7 @@ FRDGPassRef AddGradientPass(FRDGBuilder& GraphBuilder,
                             FVertexDeclarationRHIRef VertexDeclaration,
                             FRDGTextureRef GradientTexture,
                             FBufferRHIRef GradientSpanBuffer,
+                            uint32_t GradientSpanOffset,
                             FUint32Rect Viewport,
                             uint32_t NumGradients)
 {
@@ -58,6 +59,7 @@ FRDGPassRef AddGradientPass(FRDGBuilder& GraphBuilder,
         [PassParameters = GradientPassParams,
          Viewport,
          GradientSpanBuffer,
+         GradientSpanOffset,
          NumGradients,
          VertexDeclaration,
          VertexShader,
@@ -102,7 +104,9 @@ FRDGPassRef AddGradientPass(FRDGBuilder& GraphBuilder,
                                 VertexShader.GetVertexShader(),
                                 PassParameters->VS);
 
-            RHICmdList.SetStreamSource(0, GradientSpanBuffer, 0);
+            RHICmdList.SetStreamSource(0,
+                                       GradientSpanBuffer,
+                                       GradientSpanOffset);
 
             RHICmdList.DrawPrimitive(
                 0,
@@ -115,6 +119,7 @@ FRDGPassRef AddTessellationPass(
     FRDGBuilder& GraphBuilder,
     FVertexDeclarationRHIRef VertexDeclaration,
     FBufferRHIRef TessSpanBuffer,
+    uint32_t TessSpanOffset,
     FBufferRHIRef TessIndexBuffer,
     FUint32Rect Viewport,
     uint32_t NumTessellations,
@@ -135,6 +140,7 @@ FRDGPassRef AddTessellationPass(
         TesselationPassParameters,
         ERDGPassFlags::Raster,
         [TessSpanBuffer,
+         TessSpanOffset,
          TessIndexBuffer,
          VertexDeclaration,
          Viewport,
@@ -175,7 +181,7 @@ FRDGPassRef AddTessellationPass(
                                 VertexShader.GetVertexShader(),
                                 TesselationPassParameters->VS);
 
-            RHICmdList.SetStreamSource(0, TessSpanBuffer, 0);
+            RHICmdList.SetStreamSource(0, TessSpanBuffer, TessSpanOffset);
 
             RHICmdList.SetViewport(Viewport.Min.X,
                                    Viewport.Min.Y,
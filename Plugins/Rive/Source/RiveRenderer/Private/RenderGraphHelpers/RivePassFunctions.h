@@ -57,6 +57,7 @@ FRDGPassRef AddGradientPass(FRDGBuilder& GraphBuilder,
                             FVertexDeclarationRHIRef VertexDeclaration,
                             FRDGTextureRef GradientTexture,
                             FBufferRHIRef GradientSpanBuffer,
+                            uint32_t GradientSpanOffset,
                             FUint32Rect Viewport,
                             uint32_t NumGradients);
 
@@ -71,6 +72,7 @@ FRDGPassRef AddTessellationPass(
     FRDGBuilder& GraphBuilder,
     FVertexDeclarationRHIRef VertexDeclaration,
     FBufferRHIRef TessSpanBuffer,
+    uint32_t TessSpanOffset,
     FBufferRHIRef TessIndexBuffer,
     FUint32Rect Viewport,
     uint32_t NumTessellations,
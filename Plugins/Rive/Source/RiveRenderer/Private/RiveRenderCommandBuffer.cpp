@@ -0,0 +1,50 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRenderCommandBuffer.h"
+
+#if WITH_RIVE
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/artboard.hpp"
+#include "rive/renderer.hpp"
+THIRD_PARTY_INCLUDES_END
+
+using namespace rive;
+
+Mat2D FRiveTransformCommand::GetTransform() const
+{
+    return Mat2D(XX, XY, YX, YY, TX, TY);
+}
+
+Mat2D FRiveTranslateCommand::GetTransform() const
+{
+    return Mat2D(1.f, 0.f, 0.f, 1.f, TX, TY);
+}
+
+Mat2D FRiveAlignArtboardCommand::GetTransform() const
+{
+    return computeAlignment(static_cast<Fit>(FitType),
+                            Alignment(AlignmentX, AlignmentY),
+                            AABB(MinX, MinY, MaxX, MaxY),
+                            Artboard->bounds(),
+                            ScaleFactor);
+}
+
+int32 FRiveRenderCommandBuffer::GetPayloadSize(ERiveRenderCommandType InType)
+{
+    switch (InType)
+    {
+        case ERiveRenderCommandType::Transform:
+            return sizeof(FRiveTransformCommand);
+        case ERiveRenderCommandType::Translate:
+            return sizeof(FRiveTranslateCommand);
+        case ERiveRenderCommandType::DrawArtboard:
+            return sizeof(FRiveDrawArtboardCommand);
+        case ERiveRenderCommandType::AlignArtboard:
+            return sizeof(FRiveAlignArtboardCommand);
+        default:
+            return 0;
+    }
+}
+
+#endif // WITH_RIVE
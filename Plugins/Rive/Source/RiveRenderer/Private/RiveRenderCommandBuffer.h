@@ -0,0 +1,183 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+#include "RiveRenderCommand.h"
+
+#if WITH_RIVE
+
+namespace rive
+{
+class Artboard;
+class Mat2D;
+} // namespace rive
+
+/**
+ * Payloads of the commands recorded in a FRiveRenderCommandBuffer. They are
+ * plain data without padding, so a recorded frame can be compared with memcmp.
+ * Save and Restore have no payload.
+ */
+struct FRiveTransformCommand
+{
+    static constexpr ERiveRenderCommandType Type =
+        ERiveRenderCommandType::Transform;
+
+    float XX;
+    float XY;
+    float YX;
+    float YY;
+    float TX;
+    float TY;
+
+    rive::Mat2D GetTransform() const;
+};
+
+struct FRiveTranslateCommand
+{
+    static constexpr ERiveRenderCommandType Type =
+        ERiveRenderCommandType::Translate;
+
+    float TX;
+    float TY;
+
+    rive::Mat2D GetTransform() const;
+};
+
+struct FRiveDrawArtboardCommand
+{
+    static constexpr ERiveRenderCommandType Type =
+        ERiveRenderCommandType::DrawArtboard;
+
+    rive::Artboard* Artboard;
+
+    /** Kept alive by the buffer, see FRiveRenderCommandBuffer::KeepAlive */
+    FCriticalSection* ArtboardCS;
+};
+
+struct FRiveAlignArtboardCommand
+{
+    static constexpr ERiveRenderCommandType Type =
+        ERiveRenderCommandType::AlignArtboard;
+
+    rive::Artboard* Artboard;
+    float MinX;
+    float MinY;
+    float MaxX;
+    float MaxY;
+    float AlignmentX;
+    float AlignmentY;
+    float ScaleFactor;
+    /** ERiveFitType, widened so the struct has no padding */
+    uint32 FitType;
+
+    rive::Mat2D GetTransform() const;
+};
+
+/**
+ * Linear arena of render commands for one frame. Each command is a one byte
+ * ERiveRenderCommandType followed by its payload.
+ *
+ * FRiveRenderTarget records into one buffer and hands it to the render thread
+ * by pointer. The buffer is recycled once the render thread is done with it,
+ * so steady state frames neither allocate nor copy their commands.
+ */
+class FRiveRenderCommandBuffer
+{
+public:
+    class FIterator
+    {
+    public:
+        explicit FIterator(const FRiveRenderCommandBuffer& InBuffer) :
+            Buffer(InBuffer)
+        {}
+
+        explicit operator bool() const { return Offset < Buffer.Data.Num(); }
+
+        ERiveRenderCommandType GetType() const
+        {
+            return static_cast<ERiveRenderCommandType>(Buffer.Data[Offset]);
+        }
+
+        template <typename CommandType> CommandType Get() const
+        {
+            check(GetType() == CommandType::Type);
+            CommandType Command;
+            FMemory::Memcpy(&Command,
+                            &Buffer.Data[Offset + 1],
+                            sizeof(CommandType));
+            return Command;
+        }
+
+        FIterator& operator++()
+        {
+            Offset += 1 + GetPayloadSize(GetType());
+            return *this;
+        }
+
+    private:
+        const FRiveRenderCommandBuffer& Buffer;
+        int32 Offset = 0;
+    };
+
+    void Reset()
+    {
+        Data.Reset();
+        ArtboardLocks.Reset();
+    }
+
+    bool IsEmpty() const { return Data.IsEmpty(); }
+
+    void WriteMarker(ERiveRenderCommandType InType)
+    {
+        check(GetPayloadSize(InType) == 0);
+        Data.Add(static_cast<uint8>(InType));
+    }
+
+    template <typename CommandType> void Write(const CommandType& InCommand)
+    {
+        static_assert(TIsPODType<CommandType>::Value,
+                      "Render command payloads must be plain data");
+        const int32 Offset = Data.AddUninitialized(1 + sizeof(CommandType));
+        Data[Offset] = static_cast<uint8>(CommandType::Type);
+        FMemory::Memcpy(&Data[Offset + 1], &InCommand, sizeof(CommandType));
+    }
+
+    /** Holds InLock until the buffer is reset, the render thread locks it */
+    void KeepAlive(const TSharedPtr<FCriticalSection>& InLock)
+    {
+        if (InLock)
+        {
+            ArtboardLocks.Add(InLock);
+        }
+    }
+
+    void CopyFrom(const FRiveRenderCommandBuffer& Other)
+    {
+        Data = Other.Data;
+        ArtboardLocks = Other.ArtboardLocks;
+    }
+
+    bool HasSameCommands(const FRiveRenderCommandBuffer& Other) const
+    {
+        return Data.Num() == Other.Data.Num() &&
+               FMemory::Memcmp(Data.GetData(),
+                               Other.Data.GetData(),
+                               Data.Num()) == 0;
+    }
+
+    /** Set while the buffer waits for or is read by the render thread */
+    bool IsInFlight() const { return bIsInFlight; }
+    void MarkInFlight() { bIsInFlight = true; }
+    void MarkReleased() const { bIsInFlight = false; }
+
+    static int32 GetPayloadSize(ERiveRenderCommandType InType);
+
+private:
+    TArray<uint8> Data;
+    TArray<TSharedPtr<FCriticalSection>> ArtboardLocks;
+    mutable FThreadSafeBool bIsInFlight = false;
+};
+
+#endif // WITH_RIVE
@@ -3,9 +3,14 @@
 #include "RiveRenderTarget.h"
 
 #include "RiveRenderer.h"
+#include "RiveScopeLock.h"
 #include "Engine/Texture2DDynamic.h"
 #include "Logs/RiveRendererLog.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeExit.h"
 #include "RenderingThread.h"
+#include "RiveStats.h"
+#include "RiveTrace.h"
 #include "TextureResource.h"
 
 THIRD_PARTY_INCLUDES_START
@@ -19,6 +24,13 @@ THIRD_PARTY_INCLUDES_END
 #include "Mac/AutoreleasePool.h"
 #endif
 
+static TAutoConsoleVariable<bool> CVarRiveSkipIdleFrames(
+    TEXT("r.rive.skipidleframes"),
+    true,
+    TEXT("If true, render targets whose artboards have settled and whose "
+         "render commands did not change keep their previous contents instead "
+         "of being redrawn."));
+
 FTimespan FRiveRenderTarget::ResetTimeLimit = FTimespan(0, 0, 20);
 
 FRiveRenderTarget::FRiveRenderTarget(
@@ -38,7 +50,7 @@ void FRiveRenderTarget::Initialize()
 {
     check(IsInGameThread());
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    bHasSubmitted = false;
     FTextureResource* RenderTargetResource = RenderTarget->GetResource();
     check(RenderTargetResource);
     ENQUEUE_RENDER_COMMAND(CacheTextureTarget_RenderThread)
@@ -53,32 +65,47 @@ void FRiveRenderTarget::Submit()
 {
     check(IsInGameThread());
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    const FRiveRenderCommandBuffer& Submitted = HandOffRecordingBuffer();
 
-    // Making a copy of the RenderCommands to be processed on RenderingThread
-    ENQUEUE_RENDER_COMMAND(Render)
-    ([this, RiveRenderCommands = RenderCommands](
-         FRHICommandListImmediate& RHICmdList) {
-        Render_RenderThread(RHICmdList, RiveRenderCommands);
-    });
+    // Submit leaves the commands queued, the render thread owns the submitted
+    // buffer now so recording continues on a copy
+    GetRecordingBuffer().CopyFrom(Submitted);
 }
 
 void FRiveRenderTarget::SubmitAndClear()
 {
-    Submit();
-    RenderCommands.Empty();
+    HandOffRecordingBuffer();
+    TransformStack.Reset();
+}
+
+bool FRiveRenderTarget::SubmitAndClearIfChanged(bool bInContentChanged)
+{
+    check(IsInGameThread());
+
+    if (!bInContentChanged && bHasSubmitted && LastSubmittedBuffer &&
+        CVarRiveSkipIdleFrames.GetValueOnGameThread() &&
+        GetRecordingBuffer().HasSameCommands(*LastSubmittedBuffer))
+    {
+        INC_DWORD_STAT(STAT_RiveSkippedIdleFrames);
+        RecordingBuffer->Reset();
+        TransformStack.Reset();
+        return false;
+    }
+
+    SubmitAndClear();
+    return true;
 }
 
 void FRiveRenderTarget::Save()
 {
-    const FRiveRenderCommand RenderCommand(ERiveRenderCommandType::Save);
-    RenderCommands.Push(RenderCommand);
+    GetRecordingBuffer().WriteMarker(ERiveRenderCommandType::Save);
+    TransformStack.Save();
 }
 
 void FRiveRenderTarget::Restore()
 {
-    const FRiveRenderCommand RenderCommand(ERiveRenderCommandType::Restore);
-    RenderCommands.Push(RenderCommand);
+    GetRecordingBuffer().WriteMarker(ERiveRenderCommandType::Restore);
+    TransformStack.Restore();
 }
 
 void FRiveRenderTarget::Transform(float X1,
@@ -88,29 +115,24 @@ void FRiveRenderTarget::Transform(float X1,
                                   float TX,
                                   float TY)
 {
-    FRiveRenderCommand RenderCommand(ERiveRenderCommandType::Transform);
-    RenderCommand.X = X1;
-    RenderCommand.Y = Y1;
-    RenderCommand.X2 = X2;
-    RenderCommand.Y2 = Y2;
-    RenderCommand.TX = TX;
-    RenderCommand.TY = TY;
-    RenderCommands.Push(RenderCommand);
+    const FRiveTransformCommand Command{X1, Y1, X2, Y2, TX, TY};
+    GetRecordingBuffer().Write(Command);
+    TransformStack.Apply(Command.GetTransform());
 }
 
 void FRiveRenderTarget::Translate(const FVector2f& InVector)
 {
-    FRiveRenderCommand RenderCommand(ERiveRenderCommandType::Translate);
-    RenderCommand.TX = InVector.X;
-    RenderCommand.TY = InVector.Y;
-    RenderCommands.Push(RenderCommand);
+    const FRiveTranslateCommand Command{InVector.X, InVector.Y};
+    GetRecordingBuffer().Write(Command);
+    TransformStack.Apply(Command.GetTransform());
 }
 
-void FRiveRenderTarget::Draw(rive::Artboard* InArtboard)
+void FRiveRenderTarget::Draw(rive::Artboard* InArtboard,
+                             const TSharedPtr<FCriticalSection>& InArtboardCS)
 {
-    FRiveRenderCommand RenderCommand(ERiveRenderCommandType::DrawArtboard);
-    RenderCommand.NativeArtboard = InArtboard;
-    RenderCommands.Push(RenderCommand);
+    FRiveRenderCommandBuffer& Buffer = GetRecordingBuffer();
+    Buffer.KeepAlive(InArtboardCS);
+    Buffer.Write(FRiveDrawArtboardCommand{InArtboard, InArtboardCS.Get()});
 }
 
 void FRiveRenderTarget::Align(const FBox2f& InBox,
@@ -119,23 +141,18 @@ void FRiveRenderTarget::Align(const FBox2f& InBox,
                               float InScaleFactor,
                               rive::Artboard* InArtboard)
 {
-    FRiveRenderCommand RenderCommand(ERiveRenderCommandType::AlignArtboard);
-    RenderCommand.FitType = InFit;
-    RenderCommand.X = InAlignment.X;
-    RenderCommand.Y = InAlignment.Y;
-
-    if (InFit == ERiveFitType::Layout)
-        RenderCommand.ScaleFactor = InScaleFactor;
-    else
-        RenderCommand.ScaleFactor = 1;
-
-    RenderCommand.TX = InBox.Min.X;
-    RenderCommand.TY = InBox.Min.Y;
-    RenderCommand.X2 = InBox.Max.X;
-    RenderCommand.Y2 = InBox.Max.Y;
-
-    RenderCommand.NativeArtboard = InArtboard;
-    RenderCommands.Push(RenderCommand);
+    FRiveAlignArtboardCommand Command;
+    Command.Artboard = InArtboard;
+    Command.MinX = InBox.Min.X;
+    Command.MinY = InBox.Min.Y;
+    Command.MaxX = InBox.Max.X;
+    Command.MaxY = InBox.Max.Y;
+    Command.AlignmentX = InAlignment.X;
+    Command.AlignmentY = InAlignment.Y;
+    Command.ScaleFactor = InFit == ERiveFitType::Layout ? InScaleFactor : 1.f;
+    Command.FitType = static_cast<uint32>(InFit);
+    GetRecordingBuffer().Write(Command);
+    TransformStack.Apply(Command.GetTransform());
 }
 
 void FRiveRenderTarget::Align(ERiveFitType InFit,
@@ -152,39 +169,65 @@ void FRiveRenderTarget::Align(ERiveFitType InFit,
 
 FMatrix FRiveRenderTarget::GetTransformMatrix() const
 {
-    TArray<FMatrix> SavedMatrices;
-    FMatrix CurrentMatrix = FMatrix::Identity;
+    return TransformStack.Get();
+}
+
+FRiveRenderCommandBuffer& FRiveRenderTarget::GetRecordingBuffer()
+{
+    if (RecordingBuffer)
+    {
+        return *RecordingBuffer;
+    }
 
-    for (const FRiveRenderCommand& RenderCommand : RenderCommands)
+    // Any buffer the render thread is done with, except the last submitted
+    // one which idle frames are compared against
+    for (const TUniquePtr<FRiveRenderCommandBuffer>& Buffer : CommandBuffers)
     {
-        switch (RenderCommand.Type)
+        if (!Buffer->IsInFlight() && Buffer.Get() != LastSubmittedBuffer)
         {
-            case ERiveRenderCommandType::Save:
-                SavedMatrices.Add(CurrentMatrix);
-                break;
-            case ERiveRenderCommandType::Restore:
-                CurrentMatrix = SavedMatrices.IsEmpty() ? FMatrix::Identity
-                                                        : SavedMatrices.Pop();
-                break;
-            case ERiveRenderCommandType::AlignArtboard:
-            case ERiveRenderCommandType::Transform:
-            case ERiveRenderCommandType::Translate:
-                CurrentMatrix =
-                    RenderCommand.GetSavedTransform() * CurrentMatrix;
-                break;
-            default:
-                break;
+            RecordingBuffer = Buffer.Get();
+            RecordingBuffer->Reset();
+            return *RecordingBuffer;
         }
     }
-    return CurrentMatrix;
+
+    RecordingBuffer =
+        CommandBuffers.Add_GetRef(MakeUnique<FRiveRenderCommandBuffer>()).Get();
+    return *RecordingBuffer;
+}
+
+const FRiveRenderCommandBuffer& FRiveRenderTarget::HandOffRecordingBuffer()
+{
+    check(IsInGameThread());
+
+    FRiveRenderCommandBuffer& Buffer = GetRecordingBuffer();
+    Buffer.MarkInFlight();
+    RecordingBuffer = nullptr;
+    LastSubmittedBuffer = &Buffer;
+    bHasSubmitted = true;
+
+    Submit_Internal(Buffer);
+    return Buffer;
+}
+
+void FRiveRenderTarget::Submit_Internal(
+    const FRiveRenderCommandBuffer& InCommandBuffer)
+{
+    ENQUEUE_RENDER_COMMAND(Render)
+    ([this, CommandBuffer = &InCommandBuffer](
+         FRHICommandListImmediate& RHICmdList) {
+        Render_RenderThread(RHICmdList, *CommandBuffer);
+    });
 }
 
 void FRiveRenderTarget::RegisterRenderCommand(RiveRenderFunction RenderFunction)
 {
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    // Draws outside of the command list, the next frame can not be skipped
+    bHasSubmitted = false;
     ENQUEUE_RENDER_COMMAND(FRiveRenderTarget_CustomRenderCommand)
     ([this, RenderFunction = std::move(RenderFunction)](
          FRHICommandListImmediate& RHICmdList) {
+        FRiveScopeLock Lock(&RiveRenderer->GetThreadDataCS());
         auto renderer = BeginFrame();
         if (!renderer)
         {
@@ -209,8 +252,8 @@ std::unique_ptr<rive::RiveRenderer> FRiveRenderTarget::BeginFrame()
 
     FColor Color = ClearColor.ToRGBE();
     rive::gpu::RenderContext::FrameDescriptor FrameDescriptor;
-    FrameDescriptor.renderTargetWidth = GetWidth();
-    FrameDescriptor.renderTargetHeight = GetHeight();
+    FrameDescriptor.renderTargetWidth = GetWidth_RenderThread();
+    FrameDescriptor.renderTargetHeight = GetHeight_RenderThread();
     FrameDescriptor.loadAction =
         bIsCleared ? rive::gpu::LoadAction::clear
                    : rive::gpu::LoadAction::preserveRenderTarget;
@@ -239,6 +282,7 @@ void FRiveRenderTarget::EndFrame() const
 
     // End drawing a frame.
     // Flush
+    RIVE_TRACE_SCOPE(RiveFlush);
 #if PLATFORM_ANDROID
     RIVE_DEBUG_VERBOSE("RenderContext->flush %p", RenderContext);
 #endif
@@ -251,26 +295,45 @@ uint32 FRiveRenderTarget::GetWidth() const { return RenderTarget->SizeX; }
 
 uint32 FRiveRenderTarget::GetHeight() const { return RenderTarget->SizeY; }
 
+uint32 FRiveRenderTarget::GetWidth_RenderThread() const
+{
+    const rive::rcp<rive::gpu::RenderTarget> Target = GetRenderTarget();
+    return Target ? Target->width() : GetWidth();
+}
+
+uint32 FRiveRenderTarget::GetHeight_RenderThread() const
+{
+    const rive::rcp<rive::gpu::RenderTarget> Target = GetRenderTarget();
+    return Target ? Target->height() : GetHeight();
+}
+
 DECLARE_GPU_STAT_NAMED(Render, TEXT("RiveRenderTarget::Render"));
 void FRiveRenderTarget::Render_RenderThread(
     FRHICommandListImmediate& RHICmdList,
-    const TArray<FRiveRenderCommand>& RiveRenderCommands)
+    const FRiveRenderCommandBuffer& InCommandBuffer)
 {
     SCOPED_GPU_STAT(RHICmdList, Render);
     SCOPED_DRAW_EVENT(RHICmdList, RiveRender);
     check(IsInRenderingThread());
 
-    Render_Internal(RiveRenderCommands);
+    Render_Internal(InCommandBuffer);
 }
 
 void FRiveRenderTarget::Render_Internal(
-    const TArray<FRiveRenderCommand>& RiveRenderCommands)
+    const FRiveRenderCommandBuffer& InCommandBuffer)
 {
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    RIVE_TRACE_SCOPE_TEXT(RiveName.ToString());
+
+    // Hands the buffer back to the game thread for recording once done
+    ON_SCOPE_EXIT { InCommandBuffer.MarkReleased(); };
+
+    // Only the render context is shared between render targets, artboards are
+    // locked individually below while they are being drawn
+    FRiveScopeLock Lock(&RiveRenderer->GetThreadDataCS());
 
     // Sometimes Render commands can be empty (perhaps an issue with Lock
     // contention) Checking for empty here will prevent rendered "blank" frames
-    if (RiveRenderCommands.IsEmpty())
+    if (InCommandBuffer.IsEmpty())
     {
         return;
     }
@@ -290,25 +353,51 @@ void FRiveRenderTarget::Render_Internal(
     // We need to invert the Y Axis for OpenGL, and this needs to not affect
     // input transforms
     Renderer->transform(
-        rive::Mat2D::fromScaleAndTranslation(1.f, -1.f, 0.f, GetHeight()));
+        rive::Mat2D::fromScaleAndTranslation(1.f,
+                                             -1.f,
+                                             0.f,
+                                             GetHeight_RenderThread()));
 #endif
 
-    for (const FRiveRenderCommand& RenderCommand : RiveRenderCommands)
+    DrawCommands(*Renderer, InCommandBuffer);
+
+    EndFrame();
+}
+
+void FRiveRenderTarget::DrawCommands(
+    rive::Renderer& InRenderer,
+    const FRiveRenderCommandBuffer& InCommandBuffer) const
+{
+    for (FRiveRenderCommandBuffer::FIterator It(InCommandBuffer); It; ++It)
     {
-        switch (RenderCommand.Type)
+        switch (It.GetType())
         {
             case ERiveRenderCommandType::Save:
-                Renderer->save();
+                InRenderer.save();
                 break;
             case ERiveRenderCommandType::Restore:
-                Renderer->restore();
+                InRenderer.restore();
                 break;
             case ERiveRenderCommandType::DrawArtboard:
+            {
 #if PLATFORM_ANDROID
                 RIVE_DEBUG_VERBOSE("RenderCommand.NativeArtboard->draw()");
 #endif
-                RenderCommand.NativeArtboard->draw(Renderer.get());
+                const FRiveDrawArtboardCommand Command =
+                    It.Get<FRiveDrawArtboardCommand>();
+                RIVE_TRACE_SCOPE_TEXT(
+                    UTF8_TO_TCHAR(Command.Artboard->name().c_str()));
+                if (Command.ArtboardCS)
+                {
+                    FRiveScopeLock ArtboardLock(Command.ArtboardCS);
+                    Command.Artboard->draw(&InRenderer);
+                }
+                else
+                {
+                    Command.Artboard->draw(&InRenderer);
+                }
                 break;
+            }
             case ERiveRenderCommandType::DrawPath:
                 // TODO: Support DrawPath
                 break;
@@ -316,12 +405,17 @@ void FRiveRenderTarget::Render_Internal(
                 // TODO: Support ClipPath
                 break;
             case ERiveRenderCommandType::Transform:
+                InRenderer.transform(
+                    It.Get<FRiveTransformCommand>().GetTransform());
+                break;
             case ERiveRenderCommandType::AlignArtboard:
+                InRenderer.transform(
+                    It.Get<FRiveAlignArtboardCommand>().GetTransform());
+                break;
             case ERiveRenderCommandType::Translate:
-                Renderer->transform(RenderCommand.GetSaved2DTransform());
+                InRenderer.transform(
+                    It.Get<FRiveTranslateCommand>().GetTransform());
                 break;
         }
     }
-
-    EndFrame();
 }
@@ -6,6 +6,8 @@
 #include "UObject/ObjectPtr.h"
 #include "IRiveRenderTarget.h"
 #include "RiveRenderCommand.h"
+#include "RiveRenderCommandBuffer.h"
+#include "RiveTransformStack.h"
 
 #if WITH_RIVE
 THIRD_PARTY_INCLUDES_START
@@ -46,6 +48,7 @@ public:
     virtual uint32 GetHeight() const override;
     virtual void SetClearColor(const FLinearColor& InColor) override
     {
+        bHasSubmitted &= ClearColor == InColor;
         ClearColor = InColor;
     }
 
@@ -58,6 +61,7 @@ public:
 #if WITH_RIVE
     virtual void Submit() override;
     virtual void SubmitAndClear() override;
+    virtual bool SubmitAndClearIfChanged(bool bInContentChanged) override;
     virtual void Save() override;
     virtual void Restore() override;
     virtual void Transform(float X1,
@@ -67,7 +71,9 @@ public:
                            float TX,
                            float TY) override;
     virtual void Translate(const FVector2f& InVector) override;
-    virtual void Draw(rive::Artboard* InArtboard) override;
+    virtual void Draw(
+        rive::Artboard* InArtboard,
+        const TSharedPtr<FCriticalSection>& InArtboardCS) override;
     virtual void Align(const FBox2f& InBox,
                        ERiveFitType InFit,
                        const FVector2f& InAlignment,
@@ -83,13 +89,43 @@ public:
 
 protected:
     virtual rive::rcp<rive::gpu::RenderTarget> GetRenderTarget() const = 0;
+    /**
+     * Size of the texture the render thread draws into, which lags behind
+     * GetWidth and GetHeight while a resize is queued
+     */
+    uint32 GetWidth_RenderThread() const;
+    uint32 GetHeight_RenderThread() const;
     virtual std::unique_ptr<rive::RiveRenderer> BeginFrame();
     virtual void EndFrame() const;
+    /** Sends InCommandBuffer to be rendered, by default on the render thread */
+    virtual void Submit_Internal(
+        const FRiveRenderCommandBuffer& InCommandBuffer);
     virtual void Render_RenderThread(
         FRHICommandListImmediate& RHICmdList,
-        const TArray<FRiveRenderCommand>& RiveRenderCommands);
+        const FRiveRenderCommandBuffer& InCommandBuffer);
+    /** Renders InCommandBuffer, then releases it for recording */
     virtual void Render_Internal(
-        const TArray<FRiveRenderCommand>& RiveRenderCommands);
+        const FRiveRenderCommandBuffer& InCommandBuffer);
+    /** Replays InCommandBuffer on InRenderer, with the artboard locks held */
+    void DrawCommands(rive::Renderer& InRenderer,
+                      const FRiveRenderCommandBuffer& InCommandBuffer) const;
+
+    FRiveRenderCommandBuffer& GetRecordingBuffer();
+
+private:
+    const FRiveRenderCommandBuffer& HandOffRecordingBuffer();
+
+protected:
+    /** Pool of command buffers, recycled once the render thread released
+     * them */
+    TArray<TUniquePtr<FRiveRenderCommandBuffer>, TInlineAllocator<3>>
+        CommandBuffers;
+    /** Buffer the game thread is recording the current frame into */
+    FRiveRenderCommandBuffer* RecordingBuffer = nullptr;
+    /** Last buffer handed to the render thread, to detect idle frames */
+    FRiveRenderCommandBuffer* LastSubmittedBuffer = nullptr;
+    /** Transform at the end of the recording buffer */
+    FRiveTransformStack TransformStack;
 #endif // WITH_RIVE
 
 protected:
@@ -97,7 +133,8 @@ protected:
     FLinearColor ClearColor = FLinearColor::Transparent;
     FName RiveName;
     TObjectPtr<UTexture2DDynamic> RenderTarget;
-    TArray<FRiveRenderCommand> RenderCommands;
+    /** False until the texture holds the result of LastSubmittedBuffer */
+    bool bHasSubmitted = false;
     TSharedPtr<FRiveRenderer> RiveRenderer;
     mutable FDateTime LastResetTime = FDateTime::Now();
     static FTimespan ResetTimeLimit;
@@ -4,6 +4,7 @@
 
 #include "Async/Async.h"
 #include "Engine/TextureRenderTarget2D.h"
+#include "IImageWrapperModule.h"
 #include "Logs/RiveRendererLog.h"
 #include "RenderingThread.h"
 #include "TextureResource.h"
@@ -87,6 +88,48 @@ rive::gpu::RenderContext* FRiveRenderer::GetRenderContext()
     return RenderContext.get();
 }
 
+rive::Factory* FRiveRenderer::GetFactory() { return GetRenderContext(); }
+
+rive::rcp<rive::RenderImage> FRiveRenderer::MakeImageFromPixels(
+    uint32 InWidth,
+    uint32 InHeight,
+    TArray<uint8> InPixels,
+    EPixelFormat InPixelFormat)
+{
+    if (!RenderContext)
+    {
+        return nullptr;
+    }
+
+    check(InPixelFormat == PF_B8G8R8A8 || InPixelFormat == PF_R8G8B8A8);
+    if (InPixelFormat == PF_R8G8B8A8)
+    {
+        // The image wrapper only compresses 8 bit BGRA
+        for (int32 Index = 0; Index + 3 < InPixels.Num(); Index += 4)
+        {
+            Swap(InPixels[Index], InPixels[Index + 2]);
+        }
+    }
+
+    TArray64<uint8> CompressedImage;
+    const FImageView ImageView(InPixels.GetData(),
+                               InWidth,
+                               InHeight,
+                               ERawImageFormat::BGRA8);
+    IImageWrapperModule& ImageWrapperModule =
+        FModuleManager::LoadModuleChecked<IImageWrapperModule>(
+            FName("ImageWrapper"));
+    if (!ImageWrapperModule.CompressImage(CompressedImage,
+                                          EImageFormat::PNG,
+                                          ImageView,
+                                          100))
+    {
+        return nullptr;
+    }
+    return RenderContext->decodeImage(
+        rive::make_span(CompressedImage.GetData(), CompressedImage.Num()));
+}
+
 #endif // WITH_RIVE
 
 UTextureRenderTarget2D* FRiveRenderer::CreateDefaultRenderTarget(
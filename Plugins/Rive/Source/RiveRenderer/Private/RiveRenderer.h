@@ -58,10 +58,33 @@ public:
     virtual void CallOrRegister_OnInitialized(
         FOnRendererInitialized::FDelegate&& Delegate) override;
 
+    virtual bool SupportsWorkerThreadDecode() const override { return true; }
+
+    virtual bool SupportsParallelImageDecode() const override { return false; }
+
+    virtual bool SupportsRawImagePixels() const override { return false; }
+
+    virtual bool SupportsTextureImages() const override { return false; }
+
 #if WITH_RIVE
 
     virtual rive::gpu::RenderContext* GetRenderContext() override;
 
+    virtual rive::Factory* GetFactory() override;
+
+    /** Encodes the pixels to PNG for the render context to decode */
+    virtual rive::rcp<rive::RenderImage> MakeImageFromPixels(
+        uint32 InWidth,
+        uint32 InHeight,
+        TArray<uint8> InPixels,
+        EPixelFormat InPixelFormat) override;
+
+    virtual rive::rcp<rive::RenderImage> MakeImageFromTexture(
+        const FTextureRHIRef& InTexture) override
+    {
+        return nullptr;
+    }
+
 #endif // WITH_RIVE
 
     //~ END : IRiveRenderer Interface
@@ -4,6 +4,7 @@
 
 #include "RiveRenderer.h"
 #include "Logs/RiveRendererLog.h"
+#include "Platform/RiveRendererNull.h"
 #include "Platform/RiveRendererRHI.h"
 #include "RiveRendererSettings.h"
 
@@ -27,7 +28,21 @@ void FRiveRendererModule::StartupModule()
 
     const URiveRendererSettings* PluginSettings =
         GetDefault<URiveRendererSettings>();
-    if (PluginSettings->bEnableRHITechPreview)
+    if (RHIGetInterfaceType() == ERHIInterfaceType::Null)
+    {
+        UE_LOG(LogRiveRenderer,
+               Display,
+               TEXT("Rive running headless on RHI 'Null', nothing is drawn"))
+        RiveRenderer = MakeShared<FRiveRendererNull>();
+    }
+    else if (FRiveRendererNull::IsSoftwareForced())
+    {
+        UE_LOG(LogRiveRenderer,
+               Display,
+               TEXT("Rive drawing with the CPU software renderer"))
+        RiveRenderer = MakeShared<FRiveRendererNull>();
+    }
+    else if (PluginSettings->bEnableRHITechPreview)
     {
         UE_LOG(LogRiveRenderer,
                Warning,
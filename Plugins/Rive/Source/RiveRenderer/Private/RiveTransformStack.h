@@ -0,0 +1,55 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_RIVE
+THIRD_PARTY_INCLUDES_START
+#include "rive/math/mat2d.hpp"
+THIRD_PARTY_INCLUDES_END
+#endif // WITH_RIVE
+
+/**
+ * Current transform of a FRiveRenderTarget, kept up to date as Save, Restore
+ * and transform commands are recorded so querying it does not need to walk
+ * the recorded commands.
+ */
+class FRiveTransformStack
+{
+public:
+    void Reset()
+    {
+        Current = FMatrix::Identity;
+        Saved.Reset();
+    }
+
+    void Save() { Saved.Add(Current); }
+
+    void Restore()
+    {
+        Current = Saved.IsEmpty() ? FMatrix::Identity : Saved.Pop();
+    }
+
+    void Apply(const FMatrix& InTransform) { Current = InTransform * Current; }
+
+#if WITH_RIVE
+    void Apply(const rive::Mat2D& InTransform) { Apply(ToMatrix(InTransform)); }
+
+    static FMatrix ToMatrix(const rive::Mat2D& InMatrix)
+    {
+        return FMatrix(FVector{InMatrix.xx(), InMatrix.xy(), 0},
+                       FVector{InMatrix.yx(), InMatrix.yy(), 0},
+                       FVector{0, 0, 1},
+                       FVector{InMatrix.tx(), InMatrix.ty(), 0});
+    }
+#endif // WITH_RIVE
+
+    const FMatrix& Get() const { return Current; }
+
+private:
+    FMatrix Current = FMatrix::Identity;
+
+    /** Artboards rarely nest more than a couple of Save calls */
+    TArray<FMatrix, TInlineAllocator<8>> Saved;
+};
@@ -0,0 +1,128 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Logs/RiveRendererLog.h"
+#include "RiveRenderCommandBuffer.h"
+#include "RiveTransformStack.h"
+
+#if WITH_RIVE && !UE_BUILD_SHIPPING
+
+namespace
+{
+/** What GetTransformMatrix used to do: replay the whole recording */
+FMatrix RescanTransform(const FRiveRenderCommandBuffer& InCommandBuffer)
+{
+    TArray<FMatrix> SavedMatrices;
+    FMatrix CurrentMatrix = FMatrix::Identity;
+
+    for (FRiveRenderCommandBuffer::FIterator It(InCommandBuffer); It; ++It)
+    {
+        switch (It.GetType())
+        {
+            case ERiveRenderCommandType::Save:
+                SavedMatrices.Add(CurrentMatrix);
+                break;
+            case ERiveRenderCommandType::Restore:
+                CurrentMatrix = SavedMatrices.IsEmpty() ? FMatrix::Identity
+                                                        : SavedMatrices.Pop();
+                break;
+            case ERiveRenderCommandType::Transform:
+                CurrentMatrix = FRiveTransformStack::ToMatrix(
+                                    It.Get<FRiveTransformCommand>()
+                                        .GetTransform()) *
+                                CurrentMatrix;
+                break;
+            default:
+                break;
+        }
+    }
+    return CurrentMatrix;
+}
+
+/**
+ * Records one frame of InArtboardCount artboards the way URiveActorComponent
+ * does (Save, transform, draw, query the transform, Restore) and returns the
+ * time spent, in milliseconds.
+ */
+double RecordFrame(int32 InArtboardCount,
+                   bool bInIncremental,
+                   FRiveRenderCommandBuffer& InCommandBuffer,
+                   FRiveTransformStack& InTransformStack,
+                   FMatrix& OutChecksum)
+{
+    InCommandBuffer.Reset();
+    InTransformStack.Reset();
+
+    const double StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < InArtboardCount; ++Index)
+    {
+        InCommandBuffer.WriteMarker(ERiveRenderCommandType::Save);
+        InTransformStack.Save();
+
+        const FRiveTransformCommand Command{1.f, 0.f, 0.f, 1.f, 10.f, 20.f};
+        InCommandBuffer.Write(Command);
+        InTransformStack.Apply(Command.GetTransform());
+
+        InCommandBuffer.Write(FRiveDrawArtboardCommand{nullptr, nullptr});
+        OutChecksum += bInIncremental ? InTransformStack.Get()
+                                      : RescanTransform(InCommandBuffer);
+
+        InCommandBuffer.WriteMarker(ERiveRenderCommandType::Restore);
+        InTransformStack.Restore();
+    }
+    return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
+
+void RunTransformStackBenchmark(const TArray<FString>& InArgs)
+{
+    const int32 FrameCount =
+        InArgs.Num() > 0 ? FMath::Max(1, FCString::Atoi(*InArgs[0])) : 1000;
+
+    FRiveRenderCommandBuffer CommandBuffer;
+    FRiveTransformStack TransformStack;
+    FMatrix Checksum(ForceInitToZero);
+
+    for (const int32 ArtboardCount : {1, 16, 256})
+    {
+        double RescanTime = 0.0;
+        double IncrementalTime = 0.0;
+        for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+        {
+            RescanTime += RecordFrame(ArtboardCount,
+                                      false,
+                                      CommandBuffer,
+                                      TransformStack,
+                                      Checksum);
+            IncrementalTime += RecordFrame(ArtboardCount,
+                                           true,
+                                           CommandBuffer,
+                                           TransformStack,
+                                           Checksum);
+        }
+
+        UE_LOG(LogRiveRenderer,
+               Display,
+               TEXT("Transform stack, %d artboard(s) per target: rescan "
+                    "%.4f ms/frame, incremental %.4f ms/frame"),
+               ArtboardCount,
+               RescanTime / FrameCount,
+               IncrementalTime / FrameCount);
+    }
+
+    // Keeps the queries from being optimized away
+    UE_LOG(LogRiveRenderer,
+           Verbose,
+           TEXT("Transform stack checksum %f"),
+           Checksum.M[3][0]);
+}
+} // namespace
+
+static FAutoConsoleCommand CmdRiveBenchmarkTransformStack(
+    TEXT("rive.Benchmark.TransformStack"),
+    TEXT("Compares querying the render target transform by replaying the "
+         "recorded commands against the incremental transform stack, for 1, "
+         "16 and 256 artboards per target. Optional argument: frame count."),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunTransformStackBenchmark));
+
+#endif // WITH_RIVE && !UE_BUILD_SHIPPING
@@ -0,0 +1,258 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveSoftwareRenderer.h"
+
+#if WITH_RIVE
+
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Logs/RiveRendererLog.h"
+#include "Modules/ModuleManager.h"
+#include "Software/RiveSoftwareResources.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/decoders/bitmap_decoder.hpp"
+#include "rive/shapes/paint/color.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace UE::Private::RiveSoftwareFactory
+{
+FVector4f ToPremultiplied(rive::ColorInt InColor)
+{
+    float Color[4];
+    rive::UnpackColorToRGBA32FPremul(InColor, Color);
+    return FVector4f(Color[0], Color[1], Color[2], Color[3]);
+}
+} // namespace UE::Private::RiveSoftwareFactory
+
+FRiveSoftwareShader::FRiveSoftwareShader(bool bInRadial,
+                                         const FVector2f& InStart,
+                                         const FVector2f& InEnd,
+                                         float InRadius,
+                                         const rive::ColorInt InColors[],
+                                         const float InStops[],
+                                         size_t InCount) :
+    bRadial(bInRadial),
+    Start(InStart),
+    Delta(InEnd - InStart),
+    InvLengthSquared(0.f),
+    InvRadius(InRadius > 0.f ? 1.f / InRadius : 0.f)
+{
+    const float LengthSquared = Delta.SizeSquared();
+    InvLengthSquared = LengthSquared > 0.f ? 1.f / LengthSquared : 0.f;
+
+    // Colors are interpolated before being premultiplied, like the GPU
+    // renderers do
+    int32 Stop = 0;
+    const int32 Count = static_cast<int32>(InCount);
+    for (int32 Index = 0; Index < LUTSize; ++Index)
+    {
+        const float T = Index / float(LUTSize - 1);
+        while (Stop + 1 < Count && InStops[Stop + 1] < T)
+        {
+            ++Stop;
+        }
+
+        if (Count == 0)
+        {
+            LUT[Index] = FVector4f::Zero();
+            continue;
+        }
+        if (Stop + 1 >= Count || T <= InStops[Stop])
+        {
+            LUT[Index] = UE::Private::RiveSoftwareFactory::ToPremultiplied(
+                InColors[T <= InStops[0] ? 0 : Stop]);
+            continue;
+        }
+
+        float From[4];
+        float To[4];
+        rive::UnpackColorToRGBA32F(InColors[Stop], From);
+        rive::UnpackColorToRGBA32F(InColors[Stop + 1], To);
+        const float Range = InStops[Stop + 1] - InStops[Stop];
+        const float Alpha = Range > 0.f ? (T - InStops[Stop]) / Range : 1.f;
+        FVector4f Color;
+        for (int32 Channel = 0; Channel < 4; ++Channel)
+        {
+            Color[Channel] = FMath::Lerp(From[Channel], To[Channel], Alpha);
+        }
+        LUT[Index] = FVector4f(Color.X * Color.W,
+                               Color.Y * Color.W,
+                               Color.Z * Color.W,
+                               Color.W);
+    }
+}
+
+FVector4f FRiveSoftwareShader::Sample(const FVector2f& InLocalPosition) const
+{
+    const FVector2f Offset = InLocalPosition - Start;
+    const float T = bRadial ? Offset.Size() * InvRadius
+                            : FVector2f::DotProduct(Offset, Delta) *
+                                  InvLengthSquared;
+    const int32 Index =
+        FMath::Clamp(FMath::RoundToInt32(T * (LUTSize - 1)), 0, LUTSize - 1);
+    return LUT[Index];
+}
+
+FVector4f FRiveSoftwareImage::Sample(const FVector2f& InUV) const
+{
+    const float X = FMath::Clamp(InUV.X - 0.5f, 0.f, float(m_Width - 1));
+    const float Y = FMath::Clamp(InUV.Y - 0.5f, 0.f, float(m_Height - 1));
+    const int32 X0 = FMath::FloorToInt32(X);
+    const int32 Y0 = FMath::FloorToInt32(Y);
+    const int32 X1 = FMath::Min(X0 + 1, m_Width - 1);
+    const int32 Y1 = FMath::Min(Y0 + 1, m_Height - 1);
+    const float FracX = X - X0;
+    const float FracY = Y - Y0;
+
+    const FVector4f Top = FMath::Lerp(Pixels[Y0 * m_Width + X0],
+                                      Pixels[Y0 * m_Width + X1],
+                                      FracX);
+    const FVector4f Bottom = FMath::Lerp(Pixels[Y1 * m_Width + X0],
+                                         Pixels[Y1 * m_Width + X1],
+                                         FracX);
+    return FMath::Lerp(Top, Bottom, FracY);
+}
+
+rive::rcp<rive::RenderBuffer> FRiveSoftwareFactory::makeRenderBuffer(
+    rive::RenderBufferType InType,
+    rive::RenderBufferFlags InFlags,
+    size_t InSizeInBytes)
+{
+    return rive::make_rcp<FRiveSoftwareBuffer>(InType, InFlags, InSizeInBytes);
+}
+
+rive::rcp<rive::RenderShader> FRiveSoftwareFactory::makeLinearGradient(
+    float InStartX,
+    float InStartY,
+    float InEndX,
+    float InEndY,
+    const rive::ColorInt InColors[],
+    const float InStops[],
+    size_t InCount)
+{
+    return rive::make_rcp<FRiveSoftwareShader>(false,
+                                               FVector2f(InStartX, InStartY),
+                                               FVector2f(InEndX, InEndY),
+                                               0.f,
+                                               InColors,
+                                               InStops,
+                                               InCount);
+}
+
+rive::rcp<rive::RenderShader> FRiveSoftwareFactory::makeRadialGradient(
+    float InCenterX,
+    float InCenterY,
+    float InRadius,
+    const rive::ColorInt InColors[],
+    const float InStops[],
+    size_t InCount)
+{
+    const FVector2f Center(InCenterX, InCenterY);
+    return rive::make_rcp<FRiveSoftwareShader>(true,
+                                               Center,
+                                               Center,
+                                               InRadius,
+                                               InColors,
+                                               InStops,
+                                               InCount);
+}
+
+rive::rcp<rive::RenderPath> FRiveSoftwareFactory::makeRenderPath(
+    rive::RawPath& InRawPath,
+    rive::FillRule InFillRule)
+{
+    return rive::make_rcp<FRiveSoftwarePath>(InRawPath, InFillRule);
+}
+
+rive::rcp<rive::RenderPath> FRiveSoftwareFactory::makeEmptyRenderPath()
+{
+    return rive::make_rcp<FRiveSoftwarePath>();
+}
+
+rive::rcp<rive::RenderPaint> FRiveSoftwareFactory::makeRenderPaint()
+{
+    return rive::make_rcp<FRiveSoftwarePaint>();
+}
+
+rive::rcp<rive::RenderImage> FRiveSoftwareFactory::decodeImage(
+    rive::Span<const uint8_t> InEncodedBytes)
+{
+    IImageWrapperModule& ImageWrapperModule =
+        FModuleManager::LoadModuleChecked<IImageWrapperModule>(
+            FName("ImageWrapper"));
+    const EImageFormat Format =
+        ImageWrapperModule.DetectImageFormat(InEncodedBytes.data(),
+                                             InEncodedBytes.size());
+    if (Format == EImageFormat::PNG || Format == EImageFormat::JPEG)
+    {
+        TSharedPtr<IImageWrapper> ImageWrapper =
+            ImageWrapperModule.CreateImageWrapper(Format);
+        TArray<uint8> Pixels;
+        if (!ImageWrapper.IsValid() ||
+            !ImageWrapper->SetCompressed(InEncodedBytes.data(),
+                                         InEncodedBytes.size()) ||
+            !ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, Pixels))
+        {
+            return nullptr;
+        }
+        return MakeImage(ImageWrapper->GetWidth(),
+                         ImageWrapper->GetHeight(),
+                         Pixels,
+                         PF_B8G8R8A8);
+    }
+
+    // WEBP and anything else rive can decode itself
+    std::unique_ptr<Bitmap> DecodedBitmap =
+        Bitmap::decode(InEncodedBytes.data(), InEncodedBytes.size());
+    if (!DecodedBitmap)
+    {
+        UE_LOG(LogRiveRenderer,
+               Warning,
+               TEXT("Software renderer could not decode an image"));
+        return nullptr;
+    }
+
+    DecodedBitmap->pixelFormat(Bitmap::PixelFormat::RGBA);
+    const uint32 Width = DecodedBitmap->width();
+    const uint32 Height = DecodedBitmap->height();
+    return MakeImage(
+        Width,
+        Height,
+        TConstArrayView<uint8>(DecodedBitmap->bytes(), Width * Height * 4),
+        PF_R8G8B8A8);
+}
+
+rive::rcp<rive::RenderImage> FRiveSoftwareFactory::MakeImage(
+    uint32 InWidth,
+    uint32 InHeight,
+    TConstArrayView<uint8> InPixels,
+    EPixelFormat InPixelFormat)
+{
+    const int32 NumPixels = InWidth * InHeight;
+    if (NumPixels == 0 || InPixels.Num() < NumPixels * 4)
+    {
+        return nullptr;
+    }
+
+    check(InPixelFormat == PF_B8G8R8A8 || InPixelFormat == PF_R8G8B8A8);
+    const int32 Red = InPixelFormat == PF_B8G8R8A8 ? 2 : 0;
+    const int32 Blue = 2 - Red;
+
+    TArray<FVector4f> Pixels;
+    Pixels.SetNumUninitialized(NumPixels);
+    for (int32 Index = 0; Index < NumPixels; ++Index)
+    {
+        const uint8* Pixel = &InPixels[Index * 4];
+        const float Alpha = Pixel[3] / 255.f;
+        Pixels[Index] = FVector4f(Pixel[Red] / 255.f * Alpha,
+                                  Pixel[1] / 255.f * Alpha,
+                                  Pixel[Blue] / 255.f * Alpha,
+                                  Alpha);
+    }
+    return rive::make_rcp<FRiveSoftwareImage>(InWidth,
+                                              InHeight,
+                                              MoveTemp(Pixels));
+}
+
+#endif // WITH_RIVE
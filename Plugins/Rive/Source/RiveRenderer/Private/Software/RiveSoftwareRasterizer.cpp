@@ -0,0 +1,350 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveSoftwareRasterizer.h"
+
+#if WITH_RIVE
+
+namespace
+{
+/** Vertical samples per pixel, coverage along a scanline is exact */
+constexpr int32 SubScanlines = 4;
+
+bool IsInside(int32 InWinding, rive::FillRule InFillRule)
+{
+    switch (InFillRule)
+    {
+        case rive::FillRule::evenOdd:
+            return (InWinding & 1) != 0;
+        case rive::FillRule::clockwise:
+            return InWinding > 0;
+        default:
+            return InWinding != 0;
+    }
+}
+
+float Luminance(const FVector3f& InColor)
+{
+    return 0.3f * InColor.X + 0.59f * InColor.Y + 0.11f * InColor.Z;
+}
+
+FVector3f ClipColor(const FVector3f& InColor)
+{
+    const float L = Luminance(InColor);
+    const float Min = InColor.GetMin();
+    const float Max = InColor.GetMax();
+    FVector3f Color = InColor;
+    if (Min < 0.f)
+    {
+        Color = FVector3f(L) + (Color - FVector3f(L)) * (L / (L - Min));
+    }
+    if (Max > 1.f)
+    {
+        Color = FVector3f(L) + (Color - FVector3f(L)) * ((1.f - L) / (Max - L));
+    }
+    return Color;
+}
+
+FVector3f SetLuminance(const FVector3f& InColor, float InLuminance)
+{
+    return ClipColor(InColor + FVector3f(InLuminance - Luminance(InColor)));
+}
+
+float Saturation(const FVector3f& InColor)
+{
+    return InColor.GetMax() - InColor.GetMin();
+}
+
+FVector3f SetSaturation(const FVector3f& InColor, float InSaturation)
+{
+    const float Min = InColor.GetMin();
+    const float Range = InColor.GetMax() - Min;
+    if (Range <= 0.f)
+    {
+        return FVector3f::ZeroVector;
+    }
+    return (InColor - FVector3f(Min)) * (InSaturation / Range);
+}
+
+float SoftLight(float InSource, float InDestination)
+{
+    if (InSource <= 0.5f)
+    {
+        return InDestination -
+               (1.f - 2.f * InSource) * InDestination * (1.f - InDestination);
+    }
+    const float D =
+        InDestination <= 0.25f
+            ? ((16.f * InDestination - 12.f) * InDestination + 4.f) *
+                  InDestination
+            : FMath::Sqrt(InDestination);
+    return InDestination + (2.f * InSource - 1.f) * (D - InDestination);
+}
+
+float HardLight(float InSource, float InDestination)
+{
+    return InSource <= 0.5f
+               ? InDestination * 2.f * InSource
+               : 1.f - (1.f - InDestination) * (2.f - 2.f * InSource);
+}
+
+/** Separable blend functions, on colors that are not premultiplied */
+float BlendChannel(float InSource, float InDestination, rive::BlendMode InMode)
+{
+    switch (InMode)
+    {
+        case rive::BlendMode::screen:
+            return InSource + InDestination - InSource * InDestination;
+        case rive::BlendMode::overlay:
+            return HardLight(InDestination, InSource);
+        case rive::BlendMode::darken:
+            return FMath::Min(InSource, InDestination);
+        case rive::BlendMode::lighten:
+            return FMath::Max(InSource, InDestination);
+        case rive::BlendMode::colorDodge:
+            if (InDestination <= 0.f)
+            {
+                return 0.f;
+            }
+            return InSource >= 1.f
+                       ? 1.f
+                       : FMath::Min(1.f, InDestination / (1.f - InSource));
+        case rive::BlendMode::colorBurn:
+            if (InDestination >= 1.f)
+            {
+                return 1.f;
+            }
+            return InSource <= 0.f
+                       ? 0.f
+                       : 1.f - FMath::Min(1.f,
+                                          (1.f - InDestination) / InSource);
+        case rive::BlendMode::hardLight:
+            return HardLight(InSource, InDestination);
+        case rive::BlendMode::softLight:
+            return SoftLight(InSource, InDestination);
+        case rive::BlendMode::difference:
+            return FMath::Abs(InSource - InDestination);
+        case rive::BlendMode::exclusion:
+            return InSource + InDestination - 2.f * InSource * InDestination;
+        case rive::BlendMode::multiply:
+            return InSource * InDestination;
+        default:
+            return InSource;
+    }
+}
+} // namespace
+
+void FRiveSoftwareEdgeList::AddPolygon(TConstArrayView<FVector2f> InPoints)
+{
+    const int32 NumPoints = InPoints.Num();
+    for (int32 Index = 0; Index < NumPoints; ++Index)
+    {
+        FVector2f Top = InPoints[Index];
+        FVector2f Bottom = InPoints[(Index + 1) % NumPoints];
+        // Horizontal edges never cross a scanline
+        if (Top.Y == Bottom.Y || !FMath::IsFinite(Top.X + Top.Y) ||
+            !FMath::IsFinite(Bottom.X + Bottom.Y))
+        {
+            continue;
+        }
+
+        const int32 Winding = Bottom.Y < Top.Y ? 1 : -1;
+        if (Winding > 0)
+        {
+            Swap(Top, Bottom);
+        }
+
+        Edges.Add({Top.X,
+                   Top.Y,
+                   Bottom.Y,
+                   (Bottom.X - Top.X) / (Bottom.Y - Top.Y),
+                   Winding});
+        MinY = FMath::Min(MinY, Top.Y);
+        MaxY = FMath::Max(MaxY, Bottom.Y);
+    }
+}
+
+void FRiveSoftwareEdgeList::RasterizeRow(int32 InY,
+                                         int32 InWidth,
+                                         rive::FillRule InFillRule,
+                                         FRiveSoftwareRowScratch& InScratch,
+                                         float* OutCoverage,
+                                         int32& OutMinX,
+                                         int32& OutMaxX) const
+{
+    OutMinX = InWidth;
+    OutMaxX = 0;
+
+    TArray<float>& Delta = InScratch.Delta;
+    if (Delta.Num() < InWidth + 1)
+    {
+        Delta.SetNumZeroed(InWidth + 1);
+    }
+
+    // Partially covered pixels get their coverage directly, the whole pixels
+    // in between as a delta at both ends of the span
+    constexpr float Weight = 1.f / SubScanlines;
+    auto AddSpan = [&](float InStartX, float InEndX) {
+        const float StartX = FMath::Clamp(InStartX, 0.f, float(InWidth));
+        const float EndX = FMath::Clamp(InEndX, 0.f, float(InWidth));
+        if (EndX <= StartX)
+        {
+            return;
+        }
+
+        const int32 StartPixel = FMath::FloorToInt32(StartX);
+        const int32 EndPixel = FMath::FloorToInt32(EndX);
+        if (StartPixel == EndPixel)
+        {
+            OutCoverage[StartPixel] += (EndX - StartX) * Weight;
+        }
+        else
+        {
+            OutCoverage[StartPixel] += (StartPixel + 1 - StartX) * Weight;
+            Delta[StartPixel + 1] += Weight;
+            Delta[EndPixel] -= Weight;
+            if (EndPixel < InWidth)
+            {
+                OutCoverage[EndPixel] += (EndX - EndPixel) * Weight;
+            }
+        }
+        OutMinX = FMath::Min(OutMinX, StartPixel);
+        OutMaxX = FMath::Max(OutMaxX, FMath::Min(EndPixel + 1, InWidth));
+    };
+
+    TArray<FRiveSoftwareRowScratch::FCrossing>& Crossings =
+        InScratch.Crossings;
+    for (int32 Sample = 0; Sample < SubScanlines; ++Sample)
+    {
+        const float SampleY = InY + (Sample + 0.5f) * Weight;
+
+        Crossings.Reset();
+        for (const FEdge& Edge : Edges)
+        {
+            if (SampleY >= Edge.Y0 && SampleY < Edge.Y1)
+            {
+                Crossings.Add({Edge.X0 + (SampleY - Edge.Y0) * Edge.DxDy,
+                               Edge.Winding});
+            }
+        }
+        if (Crossings.Num() < 2)
+        {
+            continue;
+        }
+
+        Crossings.Sort([](const FRiveSoftwareRowScratch::FCrossing& A,
+                          const FRiveSoftwareRowScratch::FCrossing& B) {
+            return A.X < B.X;
+        });
+
+        int32 Winding = 0;
+        for (int32 Index = 0; Index + 1 < Crossings.Num(); ++Index)
+        {
+            Winding += Crossings[Index].Winding;
+            if (IsInside(Winding, InFillRule))
+            {
+                AddSpan(Crossings[Index].X, Crossings[Index + 1].X);
+            }
+        }
+    }
+
+    float Running = 0.f;
+    for (int32 X = OutMinX; X < OutMaxX; ++X)
+    {
+        Running += Delta[X];
+        Delta[X] = 0.f;
+        OutCoverage[X] = FMath::Min(1.f, OutCoverage[X] + Running);
+    }
+    // Spans ending on the right edge leave their delta past the last pixel
+    Delta[InWidth] = 0.f;
+    OutMinX = FMath::Min(OutMinX, OutMaxX);
+}
+
+namespace UE::Private::RiveSoftwareRasterizer
+{
+void BlendSolidSpan(FVector4f* InOutPixels,
+                    const float* InCoverage,
+                    int32 InCount,
+                    const FVector4f& InColor)
+{
+    const VectorRegister4Float Color = VectorLoad(&InColor.X);
+    const VectorRegister4Float One = VectorOne();
+    for (int32 Index = 0; Index < InCount; ++Index)
+    {
+        const float Coverage = InCoverage[Index];
+        if (Coverage <= 0.f)
+        {
+            continue;
+        }
+
+        // Source over: Dst = Src * Coverage + Dst * (1 - SrcAlpha * Coverage)
+        float* Pixel = &InOutPixels[Index].X;
+        const VectorRegister4Float Source =
+            VectorMultiply(Color, VectorSetFloat1(Coverage));
+        const VectorRegister4Float InverseAlpha =
+            VectorSubtract(One, VectorReplicate(Source, 3));
+        VectorStore(VectorMultiplyAdd(VectorLoad(Pixel), InverseAlpha, Source),
+                    Pixel);
+    }
+}
+
+FVector4f BlendPixel(const FVector4f& InSource,
+                     const FVector4f& InDestination,
+                     rive::BlendMode InBlendMode)
+{
+    const float SourceAlpha = InSource.W;
+    const float DestinationAlpha = InDestination.W;
+    if (InBlendMode == rive::BlendMode::srcOver || DestinationAlpha <= 0.f ||
+        SourceAlpha <= 0.f)
+    {
+        return InSource + InDestination * (1.f - SourceAlpha);
+    }
+
+    // The blend functions work on colors that are not premultiplied
+    const FVector3f Source =
+        FVector3f(InSource.X, InSource.Y, InSource.Z) / SourceAlpha;
+    const FVector3f Destination =
+        FVector3f(InDestination.X, InDestination.Y, InDestination.Z) /
+        DestinationAlpha;
+
+    FVector3f Blended;
+    switch (InBlendMode)
+    {
+        case rive::BlendMode::hue:
+            Blended = SetLuminance(
+                SetSaturation(Source, Saturation(Destination)),
+                Luminance(Destination));
+            break;
+        case rive::BlendMode::saturation:
+            Blended = SetLuminance(
+                SetSaturation(Destination, Saturation(Source)),
+                Luminance(Destination));
+            break;
+        case rive::BlendMode::color:
+            Blended = SetLuminance(Source, Luminance(Destination));
+            break;
+        case rive::BlendMode::luminosity:
+            Blended = SetLuminance(Destination, Luminance(Source));
+            break;
+        default:
+            Blended = FVector3f(
+                BlendChannel(Source.X, Destination.X, InBlendMode),
+                BlendChannel(Source.Y, Destination.Y, InBlendMode),
+                BlendChannel(Source.Z, Destination.Z, InBlendMode));
+            break;
+    }
+
+    // W3C compositing: source over, with the overlap replaced by the blend
+    const FVector3f Color =
+        FVector3f(InSource.X, InSource.Y, InSource.Z) *
+            (1.f - DestinationAlpha) +
+        FVector3f(InDestination.X, InDestination.Y, InDestination.Z) *
+            (1.f - SourceAlpha) +
+        Blended * (SourceAlpha * DestinationAlpha);
+    return FVector4f(Color.X,
+                     Color.Y,
+                     Color.Z,
+                     SourceAlpha + DestinationAlpha * (1.f - SourceAlpha));
+}
+} // namespace UE::Private::RiveSoftwareRasterizer
+
+#endif // WITH_RIVE
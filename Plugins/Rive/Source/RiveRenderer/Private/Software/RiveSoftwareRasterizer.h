@@ -0,0 +1,90 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_RIVE
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/math/path_types.hpp"
+#include "rive/shapes/paint/blend_mode.hpp"
+THIRD_PARTY_INCLUDES_END
+
+/** Per thread buffers reused by FRiveSoftwareEdgeList::RasterizeRow */
+struct FRiveSoftwareRowScratch
+{
+    struct FCrossing
+    {
+        float X;
+        int32 Winding;
+    };
+
+    TArray<FCrossing> Crossings;
+    /** Coverage of whole pixels, as deltas summed along the row */
+    TArray<float> Delta;
+};
+
+/**
+ * Device space edges of a filled path, stroke or clip. Edges are stored top
+ * to bottom, Winding keeps their original direction: +1 going up, so
+ * clockwise contours (in y down space) wind positively.
+ */
+class FRiveSoftwareEdgeList
+{
+public:
+    /** Adds the edges of InPoints, closing the polygon */
+    void AddPolygon(TConstArrayView<FVector2f> InPoints);
+
+    bool IsEmpty() const { return Edges.IsEmpty(); }
+
+    /** Rows the edges cover, MaxY exclusive */
+    int32 GetMinY() const { return FMath::FloorToInt32(MinY); }
+    int32 GetMaxY() const { return FMath::CeilToInt32(MaxY); }
+
+    /**
+     * Writes the coverage, 0 to 1, of the pixels of row InY into
+     * OutCoverage, which must hold InWidth zeroed floats. OutMinX and OutMaxX
+     * (exclusive) bound the pixels written, they are equal if none were.
+     */
+    void RasterizeRow(int32 InY,
+                      int32 InWidth,
+                      rive::FillRule InFillRule,
+                      FRiveSoftwareRowScratch& InScratch,
+                      float* OutCoverage,
+                      int32& OutMinX,
+                      int32& OutMaxX) const;
+
+private:
+    struct FEdge
+    {
+        float X0;
+        float Y0;
+        float Y1;
+        float DxDy;
+        int32 Winding;
+    };
+
+    TArray<FEdge> Edges;
+    float MinY = TNumericLimits<float>::Max();
+    float MaxY = TNumericLimits<float>::Lowest();
+};
+
+namespace UE::Private::RiveSoftwareRasterizer
+{
+/**
+ * Blends a solid premultiplied color over InCount pixels, weighted by
+ * InCoverage. Vectorized, it is what most fills end up in.
+ */
+void BlendSolidSpan(FVector4f* InOutPixels,
+                    const float* InCoverage,
+                    int32 InCount,
+                    const FVector4f& InColor);
+
+/** Blends premultiplied InSource over InDestination with InBlendMode */
+FVector4f BlendPixel(const FVector4f& InSource,
+                     const FVector4f& InDestination,
+                     rive::BlendMode InBlendMode);
+} // namespace UE::Private::RiveSoftwareRasterizer
+
+#endif // WITH_RIVE
@@ -0,0 +1,784 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveSoftwareRenderer.h"
+
+#if WITH_RIVE
+
+#include "Algo/Reverse.h"
+#include "Async/ParallelFor.h"
+#include "RiveStats.h"
+#include "Software/RiveSoftwareRasterizer.h"
+#include "Software/RiveSoftwareResources.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/shapes/paint/color.hpp"
+THIRD_PARTY_INCLUDES_END
+
+/** Device space error allowed when flattening curves, in pixels */
+static constexpr float FlattenTolerance = 0.25f;
+
+/** Rows rasterized by one task of FRiveSoftwareRenderer::Flush */
+static constexpr int32 BandHeight = 32;
+
+/** Miter joins longer than this many half widths become bevels */
+static constexpr float MiterLimit = 4.f;
+
+struct FRiveSoftwareClip
+{
+    FRiveSoftwareEdgeList Edges;
+    rive::FillRule FillRule = rive::FillRule::nonZero;
+    /** Clip this one intersects, INDEX_NONE for the whole canvas */
+    int32 ParentIndex = INDEX_NONE;
+};
+
+struct FRiveSoftwareDraw
+{
+    FRiveSoftwareEdgeList Edges;
+    rive::FillRule FillRule = rive::FillRule::nonZero;
+    int32 ClipIndex = INDEX_NONE;
+    rive::BlendMode BlendMode = rive::BlendMode::srcOver;
+    float Opacity = 1.f;
+    /** Premultiplied, used when there is neither a shader nor an image */
+    FVector4f Color = FVector4f::Zero();
+    rive::rcp<FRiveSoftwareShader> Shader;
+    rive::rcp<FRiveSoftwareImage> Image;
+    /** Maps pixel centers to the shader's space, or to image pixels */
+    rive::Mat2D DeviceToLocal;
+};
+
+/** Draws and clips recorded by FRiveSoftwareRenderer until its next flush */
+class FRiveSoftwareDrawList
+{
+public:
+    struct FState
+    {
+        rive::Mat2D Transform;
+        int32 ClipIndex = INDEX_NONE;
+    };
+
+    FState Current;
+    TArray<FState> SavedStates;
+    TArray<FRiveSoftwareClip> Clips;
+    TArray<FRiveSoftwareDraw> Draws;
+};
+
+namespace UE::Private::RiveSoftwareRenderer
+{
+struct FContour
+{
+    TArray<FVector2f> Points;
+    bool bClosed = false;
+};
+
+FVector2f ToVector(const rive::Vec2D& InPoint)
+{
+    return FVector2f(InPoint.x, InPoint.y);
+}
+
+FVector2f Transform(const rive::Mat2D& InTransform, const FVector2f& InPoint)
+{
+    return ToVector(InTransform * rive::Vec2D(InPoint.X, InPoint.Y));
+}
+
+/** Segments a cubic needs to stay within FlattenTolerance (Wang's formula) */
+int32 GetCubicSegments(const rive::Mat2D& InTransform,
+                       const rive::Vec2D* InPoints)
+{
+    rive::Vec2D Points[4];
+    InTransform.mapPoints(Points, InPoints, 4);
+    const float MaxLength = FMath::Max(
+        ToVector(Points[0] - Points[1] * 2.f + Points[2]).Size(),
+        ToVector(Points[1] - Points[2] * 2.f + Points[3]).Size());
+    const float Segments = FMath::Sqrt(0.75f * MaxLength / FlattenTolerance);
+    return FMath::Clamp(FMath::CeilToInt32(Segments), 1, 256);
+}
+
+/**
+ * Flattens InPath to polylines, still in path space. InTransform maps them to
+ * device space, it only sets how finely curves are subdivided.
+ */
+void Flatten(const rive::RawPath& InPath,
+             const rive::Mat2D& InTransform,
+             TArray<FContour>& OutContours)
+{
+    FContour* Contour = nullptr;
+    for (const auto [Verb, Points] : InPath)
+    {
+        switch (Verb)
+        {
+            case rive::PathVerb::move:
+                Contour = &OutContours.AddDefaulted_GetRef();
+                Contour->Points.Add(ToVector(Points[0]));
+                break;
+            case rive::PathVerb::line:
+                Contour->Points.Add(ToVector(Points[1]));
+                break;
+            case rive::PathVerb::quad:
+            {
+                // Elevated to a cubic, which has the same shape
+                const rive::Vec2D Cubic[4] = {
+                    Points[0],
+                    Points[0] + (Points[1] - Points[0]) * (2.f / 3.f),
+                    Points[2] + (Points[1] - Points[2]) * (2.f / 3.f),
+                    Points[2]};
+                const int32 Segments = GetCubicSegments(InTransform, Cubic);
+                for (int32 Index = 1; Index <= Segments; ++Index)
+                {
+                    const float T = Index / float(Segments);
+                    const float U = 1.f - T;
+                    Contour->Points.Add(
+                        ToVector(Points[0] * (U * U) +
+                                 Points[1] * (2.f * U * T) +
+                                 Points[2] * (T * T)));
+                }
+                break;
+            }
+            case rive::PathVerb::cubic:
+            {
+                const int32 Segments = GetCubicSegments(InTransform, Points);
+                for (int32 Index = 1; Index <= Segments; ++Index)
+                {
+                    const float T = Index / float(Segments);
+                    const float U = 1.f - T;
+                    Contour->Points.Add(
+                        ToVector(Points[0] * (U * U * U) +
+                                 Points[1] * (3.f * U * U * T) +
+                                 Points[2] * (3.f * U * T * T) +
+                                 Points[3] * (T * T * T)));
+                }
+                break;
+            }
+            case rive::PathVerb::close:
+                if (Contour != nullptr)
+                {
+                    Contour->bClosed = true;
+                }
+                break;
+        }
+    }
+}
+
+/** Adds InPolygon wound positively, so overlapping ones union as nonZero */
+void AddOrientedPolygon(TArray<FVector2f>&& InPolygon,
+                        TArray<TArray<FVector2f>>& OutPolygons)
+{
+    float Area = 0.f;
+    for (int32 Index = 0; Index < InPolygon.Num(); ++Index)
+    {
+        const FVector2f& A = InPolygon[Index];
+        const FVector2f& B = InPolygon[(Index + 1) % InPolygon.Num()];
+        Area += A.X * B.Y - B.X * A.Y;
+    }
+    if (Area < 0.f)
+    {
+        Algo::Reverse(InPolygon);
+    }
+    OutPolygons.Add(MoveTemp(InPolygon));
+}
+
+void AddCircle(const FVector2f& InCenter,
+               float InRadius,
+               float InScale,
+               TArray<TArray<FVector2f>>& OutPolygons)
+{
+    const int32 Segments = FMath::Clamp(
+        FMath::CeilToInt32(FMath::Sqrt(InRadius * InScale) * 4.f),
+        8,
+        128);
+    TArray<FVector2f> Circle;
+    Circle.Reserve(Segments);
+    for (int32 Index = 0; Index < Segments; ++Index)
+    {
+        const float Angle = Index * UE_TWO_PI / Segments;
+        Circle.Add(InCenter +
+                   FVector2f(FMath::Cos(Angle), FMath::Sin(Angle)) * InRadius);
+    }
+    AddOrientedPolygon(MoveTemp(Circle), OutPolygons);
+}
+
+/**
+ * Outlines a stroke as overlapping polygons, one per segment, join and cap,
+ * in path space so non uniform transforms scale the width correctly
+ */
+void StrokeContour(const FContour& InContour,
+                   const FRiveSoftwarePaint& InPaint,
+                   float InScale,
+                   TArray<TArray<FVector2f>>& OutPolygons)
+{
+    const float HalfWidth = InPaint.Thickness * 0.5f;
+    if (HalfWidth <= 0.f)
+    {
+        return;
+    }
+
+    TArray<FVector2f> Points;
+    Points.Reserve(InContour.Points.Num());
+    for (const FVector2f& Point : InContour.Points)
+    {
+        if (Points.IsEmpty() || !Points.Last().Equals(Point, 1e-6f))
+        {
+            Points.Add(Point);
+        }
+    }
+    const bool bClosed = InContour.bClosed && Points.Num() > 2;
+    if (bClosed && Points.Last().Equals(Points[0], 1e-6f))
+    {
+        Points.Pop();
+    }
+
+    if (Points.Num() == 1)
+    {
+        // Zero length contours only show their caps
+        if (InPaint.Cap == rive::StrokeCap::round)
+        {
+            AddCircle(Points[0], HalfWidth, InScale, OutPolygons);
+        }
+        else if (InPaint.Cap == rive::StrokeCap::square)
+        {
+            const FVector2f Extent(HalfWidth, HalfWidth);
+            AddOrientedPolygon({Points[0] - Extent,
+                                Points[0] + FVector2f(HalfWidth, -HalfWidth),
+                                Points[0] + Extent,
+                                Points[0] + FVector2f(-HalfWidth, HalfWidth)},
+                               OutPolygons);
+        }
+        return;
+    }
+    if (Points.Num() < 2)
+    {
+        return;
+    }
+
+    const int32 NumPoints = Points.Num();
+    const int32 NumSegments = bClosed ? NumPoints : NumPoints - 1;
+    auto GetDirection = [&Points, NumPoints](int32 InSegment) {
+        return (Points[(InSegment + 1) % NumPoints] - Points[InSegment])
+            .GetSafeNormal();
+    };
+    auto GetNormal = [](const FVector2f& InDirection) {
+        return FVector2f(-InDirection.Y, InDirection.X);
+    };
+
+    for (int32 Segment = 0; Segment < NumSegments; ++Segment)
+    {
+        const FVector2f& Start = Points[Segment];
+        const FVector2f& End = Points[(Segment + 1) % NumPoints];
+        const FVector2f Offset = GetNormal(GetDirection(Segment)) * HalfWidth;
+        AddOrientedPolygon(
+            {Start + Offset, End + Offset, End - Offset, Start - Offset},
+            OutPolygons);
+    }
+
+    // Joins fill the gap on the outer side of each corner
+    const int32 FirstJoin = bClosed ? 0 : 1;
+    const int32 LastJoin = bClosed ? NumPoints : NumPoints - 1;
+    for (int32 Index = FirstJoin; Index < LastJoin; ++Index)
+    {
+        const FVector2f& Point = Points[Index];
+        const FVector2f In =
+            GetDirection((Index - 1 + NumSegments) % NumSegments);
+        const FVector2f Out = GetDirection(Index % NumSegments);
+        const float Cross = FVector2f::CrossProduct(In, Out);
+        if (FMath::Abs(Cross) < 1e-6f && FVector2f::DotProduct(In, Out) > 0.f)
+        {
+            continue;
+        }
+
+        if (InPaint.Join == rive::StrokeJoin::round)
+        {
+            AddCircle(Point, HalfWidth, InScale, OutPolygons);
+            continue;
+        }
+
+        const float Side = Cross > 0.f ? -1.f : 1.f;
+        const FVector2f InOffset = GetNormal(In) * (Side * HalfWidth);
+        const FVector2f OutOffset = GetNormal(Out) * (Side * HalfWidth);
+        const FVector2f Bisector = (InOffset + OutOffset).GetSafeNormal();
+        const float CosHalfAngle =
+            FVector2f::DotProduct(Bisector, InOffset / HalfWidth);
+        if (InPaint.Join == rive::StrokeJoin::miter &&
+            CosHalfAngle > 1.f / MiterLimit)
+        {
+            AddOrientedPolygon({Point,
+                                Point + InOffset,
+                                Point + Bisector * (HalfWidth / CosHalfAngle),
+                                Point + OutOffset},
+                               OutPolygons);
+        }
+        else
+        {
+            AddOrientedPolygon({Point, Point + InOffset, Point + OutOffset},
+                               OutPolygons);
+        }
+    }
+
+    if (bClosed || InPaint.Cap == rive::StrokeCap::butt)
+    {
+        return;
+    }
+
+    const FVector2f StartDirection = GetDirection(0);
+    const FVector2f EndDirection = GetDirection(NumSegments - 1);
+    if (InPaint.Cap == rive::StrokeCap::round)
+    {
+        AddCircle(Points[0], HalfWidth, InScale, OutPolygons);
+        AddCircle(Points.Last(), HalfWidth, InScale, OutPolygons);
+        return;
+    }
+
+    auto AddSquareCap = [&](const FVector2f& InPoint,
+                            const FVector2f& InDirection) {
+        const FVector2f Offset = GetNormal(InDirection) * HalfWidth;
+        const FVector2f Extension = InDirection * HalfWidth;
+        AddOrientedPolygon({InPoint + Offset,
+                            InPoint + Offset + Extension,
+                            InPoint - Offset + Extension,
+                            InPoint - Offset},
+                           OutPolygons);
+    };
+    AddSquareCap(Points[0], -StartDirection);
+    AddSquareCap(Points.Last(), EndDirection);
+}
+
+void AddTransformed(TConstArrayView<FVector2f> InPolygon,
+                    const rive::Mat2D& InTransform,
+                    FRiveSoftwareEdgeList& OutEdges)
+{
+    TArray<FVector2f, TInlineAllocator<64>> Polygon;
+    Polygon.Reserve(InPolygon.Num());
+    for (const FVector2f& Point : InPolygon)
+    {
+        Polygon.Add(Transform(InTransform, Point));
+    }
+    OutEdges.AddPolygon(Polygon);
+}
+
+/** Device space edges of InPath, filled or stroked by InPaint */
+void BuildEdges(const FRiveSoftwarePath& InPath,
+                const FRiveSoftwarePaint* InPaint,
+                const rive::Mat2D& InTransform,
+                FRiveSoftwareEdgeList& OutEdges)
+{
+    TArray<FContour> Contours;
+    Flatten(InPath.RawPath, InTransform, Contours);
+
+    if (InPaint == nullptr || InPaint->Style == rive::RenderPaintStyle::fill)
+    {
+        for (const FContour& Contour : Contours)
+        {
+            // Fills are implicitly closed
+            AddTransformed(Contour.Points, InTransform, OutEdges);
+        }
+        return;
+    }
+
+    TArray<TArray<FVector2f>> Polygons;
+    const float Scale = InTransform.findMaxScale();
+    for (const FContour& Contour : Contours)
+    {
+        StrokeContour(Contour, *InPaint, Scale, Polygons);
+    }
+    for (const TArray<FVector2f>& Polygon : Polygons)
+    {
+        AddTransformed(Polygon, InTransform, OutEdges);
+    }
+}
+
+/** Coverage of the clip at InClipIndex for the rows of one band */
+const TArray<float>& GetClipMask(const FRiveSoftwareDrawList& InDrawList,
+                                 int32 InClipIndex,
+                                 int32 InBandY,
+                                 int32 InBandRows,
+                                 int32 InWidth,
+                                 FRiveSoftwareRowScratch& InScratch,
+                                 TMap<int32, TArray<float>>& InOutMasks)
+{
+    if (const TArray<float>* Mask = InOutMasks.Find(InClipIndex))
+    {
+        return *Mask;
+    }
+
+    const FRiveSoftwareClip& Clip = InDrawList.Clips[InClipIndex];
+    TArray<float> Mask;
+    Mask.SetNumZeroed(InBandRows * InWidth);
+    for (int32 Row = 0; Row < InBandRows; ++Row)
+    {
+        int32 MinX, MaxX;
+        Clip.Edges.RasterizeRow(InBandY + Row,
+                                InWidth,
+                                Clip.FillRule,
+                                InScratch,
+                                &Mask[Row * InWidth],
+                                MinX,
+                                MaxX);
+    }
+
+    if (Clip.ParentIndex != INDEX_NONE)
+    {
+        const TArray<float>& ParentMask = GetClipMask(InDrawList,
+                                                      Clip.ParentIndex,
+                                                      InBandY,
+                                                      InBandRows,
+                                                      InWidth,
+                                                      InScratch,
+                                                      InOutMasks);
+        for (int32 Index = 0; Index < Mask.Num(); ++Index)
+        {
+            Mask[Index] *= ParentMask[Index];
+        }
+    }
+    return InOutMasks.Add(InClipIndex, MoveTemp(Mask));
+}
+
+void RasterizeBand(const FRiveSoftwareDrawList& InDrawList,
+                   FRiveSoftwareCanvas& InCanvas,
+                   int32 InBandY,
+                   int32 InBandRows)
+{
+    using namespace UE::Private::RiveSoftwareRasterizer;
+
+    const int32 Width = InCanvas.GetWidth();
+    FRiveSoftwareRowScratch Scratch;
+    TMap<int32, TArray<float>> ClipMasks;
+    TArray<float> Coverage;
+    Coverage.SetNumZeroed(Width);
+
+    for (const FRiveSoftwareDraw& Draw : InDrawList.Draws)
+    {
+        const int32 FirstRow = FMath::Max(InBandY, Draw.Edges.GetMinY());
+        const int32 EndRow =
+            FMath::Min(InBandY + InBandRows, Draw.Edges.GetMaxY());
+        if (FirstRow >= EndRow)
+        {
+            continue;
+        }
+
+        const TArray<float>* ClipMask =
+            Draw.ClipIndex == INDEX_NONE ? nullptr
+                                         : &GetClipMask(InDrawList,
+                                                        Draw.ClipIndex,
+                                                        InBandY,
+                                                        InBandRows,
+                                                        Width,
+                                                        Scratch,
+                                                        ClipMasks);
+
+        for (int32 Y = FirstRow; Y < EndRow; ++Y)
+        {
+            int32 MinX, MaxX;
+            Draw.Edges.RasterizeRow(Y,
+                                    Width,
+                                    Draw.FillRule,
+                                    Scratch,
+                                    Coverage.GetData(),
+                                    MinX,
+                                    MaxX);
+            if (MinX >= MaxX)
+            {
+                continue;
+            }
+
+            float* RowCoverage = Coverage.GetData();
+            if (ClipMask != nullptr)
+            {
+                const float* RowMask = &(*ClipMask)[(Y - InBandY) * Width];
+                for (int32 X = MinX; X < MaxX; ++X)
+                {
+                    RowCoverage[X] *= RowMask[X];
+                }
+            }
+
+            FVector4f* Pixels = InCanvas.GetRow(Y);
+            if (!Draw.Shader && !Draw.Image &&
+                Draw.BlendMode == rive::BlendMode::srcOver)
+            {
+                BlendSolidSpan(Pixels + MinX,
+                               RowCoverage + MinX,
+                               MaxX - MinX,
+                               Draw.Color * Draw.Opacity);
+            }
+            else
+            {
+                for (int32 X = MinX; X < MaxX; ++X)
+                {
+                    const float PixelCoverage = RowCoverage[X] * Draw.Opacity;
+                    if (PixelCoverage <= 0.f)
+                    {
+                        continue;
+                    }
+
+                    FVector4f Source = Draw.Color;
+                    if (Draw.Shader || Draw.Image)
+                    {
+                        const FVector2f Local =
+                            Transform(Draw.DeviceToLocal,
+                                      FVector2f(X + 0.5f, Y + 0.5f));
+                        Source = Draw.Shader ? Draw.Shader->Sample(Local)
+                                             : Draw.Image->Sample(Local);
+                    }
+                    Pixels[X] = BlendPixel(Source * PixelCoverage,
+                                           Pixels[X],
+                                           Draw.BlendMode);
+                }
+            }
+            FMemory::Memzero(RowCoverage + MinX,
+                             (MaxX - MinX) * sizeof(float));
+        }
+    }
+}
+} // namespace UE::Private::RiveSoftwareRenderer
+
+void FRiveSoftwareCanvas::Resize(int32 InWidth, int32 InHeight)
+{
+    Width = FMath::Max(0, InWidth);
+    Height = FMath::Max(0, InHeight);
+    Pixels.SetNumZeroed(Width * Height);
+}
+
+void FRiveSoftwareCanvas::Clear(const FLinearColor& InColor)
+{
+    const FVector4f Color(InColor.R * InColor.A,
+                          InColor.G * InColor.A,
+                          InColor.B * InColor.A,
+                          InColor.A);
+    for (FVector4f& Pixel : Pixels)
+    {
+        Pixel = Color;
+    }
+}
+
+void FRiveSoftwareCanvas::ReadPixels(TArray<FColor>& OutPixels) const
+{
+    auto Quantize = [](float InValue) {
+        return static_cast<uint8>(
+            FMath::RoundToInt32(FMath::Clamp(InValue, 0.f, 1.f) * 255.f));
+    };
+
+    OutPixels.SetNumUninitialized(Pixels.Num());
+    for (int32 Index = 0; Index < Pixels.Num(); ++Index)
+    {
+        const FVector4f& Pixel = Pixels[Index];
+        OutPixels[Index] = FColor(Quantize(Pixel.X),
+                                  Quantize(Pixel.Y),
+                                  Quantize(Pixel.Z),
+                                  Quantize(Pixel.W));
+    }
+}
+
+FRiveSoftwareRenderer::FRiveSoftwareRenderer(FRiveSoftwareCanvas& InCanvas) :
+    Canvas(InCanvas), DrawList(MakeUnique<FRiveSoftwareDrawList>())
+{}
+
+FRiveSoftwareRenderer::~FRiveSoftwareRenderer() {}
+
+void FRiveSoftwareRenderer::save()
+{
+    DrawList->SavedStates.Add(DrawList->Current);
+}
+
+void FRiveSoftwareRenderer::restore()
+{
+    if (!DrawList->SavedStates.IsEmpty())
+    {
+        DrawList->Current = DrawList->SavedStates.Pop();
+    }
+}
+
+void FRiveSoftwareRenderer::transform(const rive::Mat2D& InTransform)
+{
+    DrawList->Current.Transform = DrawList->Current.Transform * InTransform;
+}
+
+void FRiveSoftwareRenderer::drawPath(rive::RenderPath* InPath,
+                                     rive::RenderPaint* InPaint)
+{
+    LITE_RTTI_CAST_OR_RETURN(Path, FRiveSoftwarePath*, InPath);
+    LITE_RTTI_CAST_OR_RETURN(Paint, FRiveSoftwarePaint*, InPaint);
+
+    FRiveSoftwareDraw Draw;
+    Draw.FillRule = Paint->Style == rive::RenderPaintStyle::fill
+                        ? Path->FillRule
+                        : rive::FillRule::nonZero;
+    Draw.ClipIndex = DrawList->Current.ClipIndex;
+    Draw.BlendMode = Paint->BlendMode;
+    Draw.Shader = Paint->Shader;
+    Draw.DeviceToLocal = DrawList->Current.Transform.invertOrIdentity();
+    if (!Draw.Shader)
+    {
+        float Color[4];
+        rive::UnpackColorToRGBA32FPremul(Paint->Color, Color);
+        Draw.Color = FVector4f(Color[0], Color[1], Color[2], Color[3]);
+        if (Draw.Color.W <= 0.f)
+        {
+            return;
+        }
+    }
+
+    UE::Private::RiveSoftwareRenderer::BuildEdges(*Path,
+                                                  Paint,
+                                                  DrawList->Current.Transform,
+                                                  Draw.Edges);
+    if (!Draw.Edges.IsEmpty())
+    {
+        DrawList->Draws.Add(MoveTemp(Draw));
+    }
+}
+
+void FRiveSoftwareRenderer::clipPath(rive::RenderPath* InPath)
+{
+    LITE_RTTI_CAST_OR_RETURN(Path, FRiveSoftwarePath*, InPath);
+
+    FRiveSoftwareClip Clip;
+    Clip.FillRule = Path->FillRule;
+    Clip.ParentIndex = DrawList->Current.ClipIndex;
+    UE::Private::RiveSoftwareRenderer::BuildEdges(*Path,
+                                                  nullptr,
+                                                  DrawList->Current.Transform,
+                                                  Clip.Edges);
+    DrawList->Current.ClipIndex = DrawList->Clips.Add(MoveTemp(Clip));
+}
+
+void FRiveSoftwareRenderer::drawImage(const rive::RenderImage* InImage,
+                                      rive::BlendMode InBlendMode,
+                                      float InOpacity)
+{
+    auto Image = rive::lite_rtti_cast<const FRiveSoftwareImage*>(InImage);
+    if (Image == nullptr || InOpacity <= 0.f)
+    {
+        return;
+    }
+
+    // Images are drawn over [0, width] x [0, height] of the current space
+    const float Width = Image->width();
+    const float Height = Image->height();
+    const rive::Mat2D& Transform = DrawList->Current.Transform;
+
+    FRiveSoftwareDraw Draw;
+    Draw.ClipIndex = DrawList->Current.ClipIndex;
+    Draw.BlendMode = InBlendMode;
+    Draw.Opacity = InOpacity;
+    Draw.Image = rive::ref_rcp(const_cast<FRiveSoftwareImage*>(Image));
+    Draw.DeviceToLocal = Transform.invertOrIdentity();
+    UE::Private::RiveSoftwareRenderer::AddTransformed(
+        {FVector2f(0.f, 0.f),
+         FVector2f(Width, 0.f),
+         FVector2f(Width, Height),
+         FVector2f(0.f, Height)},
+        Transform,
+        Draw.Edges);
+    DrawList->Draws.Add(MoveTemp(Draw));
+}
+
+void FRiveSoftwareRenderer::drawImageMesh(
+    const rive::RenderImage* InImage,
+    rive::rcp<rive::RenderBuffer> InVertices,
+    rive::rcp<rive::RenderBuffer> InUVCoords,
+    rive::rcp<rive::RenderBuffer> InIndices,
+    uint32_t InVertexCount,
+    uint32_t InIndexCount,
+    rive::BlendMode InBlendMode,
+    float InOpacity)
+{
+    using UE::Private::RiveSoftwareRenderer::Transform;
+
+    auto Image = rive::lite_rtti_cast<const FRiveSoftwareImage*>(InImage);
+    auto Vertices =
+        rive::lite_rtti_cast<FRiveSoftwareBuffer*>(InVertices.get());
+    auto UVCoords =
+        rive::lite_rtti_cast<FRiveSoftwareBuffer*>(InUVCoords.get());
+    auto Indices = rive::lite_rtti_cast<FRiveSoftwareBuffer*>(InIndices.get());
+    if (Image == nullptr || Vertices == nullptr || UVCoords == nullptr ||
+        Indices == nullptr || InOpacity <= 0.f)
+    {
+        return;
+    }
+
+    const FVector2f* Positions =
+        reinterpret_cast<const FVector2f*>(Vertices->GetData());
+    const FVector2f* UVs =
+        reinterpret_cast<const FVector2f*>(UVCoords->GetData());
+    const uint16* Triangles =
+        reinterpret_cast<const uint16*>(Indices->GetData());
+    const FVector2f ImageSize(Image->width(), Image->height());
+    const rive::Mat2D& DeviceTransform = DrawList->Current.Transform;
+
+    // Each triangle maps device space to image pixels with its own affine
+    // transform, so it is drawn like an image
+    for (uint32 Index = 0; Index + 2 < InIndexCount; Index += 3)
+    {
+        FVector2f Points[3];
+        FVector2f Pixels[3];
+        bool bValid = true;
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const uint16 Vertex = Triangles[Index + Corner];
+            bValid &= Vertex < InVertexCount;
+            if (bValid)
+            {
+                Points[Corner] = Transform(DeviceTransform, Positions[Vertex]);
+                Pixels[Corner] = UVs[Vertex] * ImageSize;
+            }
+        }
+        if (!bValid)
+        {
+            continue;
+        }
+
+        const rive::Mat2D BarycentricToDevice(Points[1].X - Points[0].X,
+                                              Points[1].Y - Points[0].Y,
+                                              Points[2].X - Points[0].X,
+                                              Points[2].Y - Points[0].Y,
+                                              Points[0].X,
+                                              Points[0].Y);
+        rive::Mat2D DeviceToBarycentric;
+        if (!BarycentricToDevice.invert(&DeviceToBarycentric))
+        {
+            continue;
+        }
+        const rive::Mat2D BarycentricToPixels(Pixels[1].X - Pixels[0].X,
+                                              Pixels[1].Y - Pixels[0].Y,
+                                              Pixels[2].X - Pixels[0].X,
+                                              Pixels[2].Y - Pixels[0].Y,
+                                              Pixels[0].X,
+                                              Pixels[0].Y);
+
+        FRiveSoftwareDraw Draw;
+        Draw.ClipIndex = DrawList->Current.ClipIndex;
+        Draw.BlendMode = InBlendMode;
+        Draw.Opacity = InOpacity;
+        Draw.Image = rive::ref_rcp(const_cast<FRiveSoftwareImage*>(Image));
+        Draw.DeviceToLocal = BarycentricToPixels * DeviceToBarycentric;
+        Draw.Edges.AddPolygon(Points);
+        DrawList->Draws.Add(MoveTemp(Draw));
+    }
+}
+
+void FRiveSoftwareRenderer::Flush()
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRiveSoftwareRenderer::Flush"),
+                                STAT_FRiveSoftwareRenderer_Flush,
+                                STATGROUP_Rive);
+
+    const int32 NumBands =
+        FMath::DivideAndRoundUp(Canvas.GetHeight(), BandHeight);
+    if (!DrawList->Draws.IsEmpty() && Canvas.GetWidth() > 0)
+    {
+        // Bands only write their own rows, the draw list is read only
+        ParallelFor(NumBands, [this](int32 Band) {
+            const int32 BandY = Band * BandHeight;
+            UE::Private::RiveSoftwareRenderer::RasterizeBand(
+                *DrawList,
+                Canvas,
+                BandY,
+                FMath::Min(BandHeight, Canvas.GetHeight() - BandY));
+        });
+    }
+
+    // Like a GPU frame, the next one starts from a clean state
+    DrawList->Clips.Reset();
+    DrawList->Draws.Reset();
+    DrawList->SavedStates.Reset();
+    DrawList->Current = FRiveSoftwareDrawList::FState();
+}
+
+#endif // WITH_RIVE
@@ -0,0 +1,181 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RiveSoftwareRenderer.h"
+
+#if WITH_RIVE
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/math/raw_path.hpp"
+#include "utils/lite_rtti.hpp"
+THIRD_PARTY_INCLUDES_END
+
+/**
+ * Render objects made by FRiveSoftwareFactory. They only hold what the
+ * rasterizer needs, in plain CPU memory.
+ */
+
+class FRiveSoftwarePath
+    : public rive::LITE_RTTI_OVERRIDE(rive::RenderPath, FRiveSoftwarePath)
+{
+public:
+    FRiveSoftwarePath() = default;
+
+    FRiveSoftwarePath(rive::RawPath& InRawPath, rive::FillRule InFillRule) :
+        FillRule(InFillRule)
+    {
+        RawPath.swap(InRawPath);
+    }
+
+    virtual void rewind() override { RawPath.rewind(); }
+
+    virtual void fillRule(rive::FillRule InFillRule) override
+    {
+        FillRule = InFillRule;
+    }
+
+    virtual void moveTo(float InX, float InY) override
+    {
+        RawPath.moveTo(InX, InY);
+    }
+
+    virtual void lineTo(float InX, float InY) override
+    {
+        RawPath.lineTo(InX, InY);
+    }
+
+    virtual void cubicTo(float InOutX,
+                         float InOutY,
+                         float InInX,
+                         float InInY,
+                         float InX,
+                         float InY) override
+    {
+        RawPath.cubicTo(InOutX, InOutY, InInX, InInY, InX, InY);
+    }
+
+    virtual void close() override { RawPath.close(); }
+
+    virtual void addRenderPath(rive::RenderPath* InPath,
+                               const rive::Mat2D& InTransform) override
+    {
+        LITE_RTTI_CAST_OR_RETURN(Path, FRiveSoftwarePath*, InPath);
+        RawPath.addPath(Path->RawPath, &InTransform);
+    }
+
+    virtual void addRawPath(const rive::RawPath& InRawPath) override
+    {
+        RawPath.addPath(InRawPath);
+    }
+
+    rive::RawPath RawPath;
+    rive::FillRule FillRule = rive::FillRule::nonZero;
+};
+
+/** Linear or radial gradient, baked into a premultiplied lookup table */
+class FRiveSoftwareShader
+    : public rive::LITE_RTTI_OVERRIDE(rive::RenderShader, FRiveSoftwareShader)
+{
+public:
+    static constexpr int32 LUTSize = 256;
+
+    FRiveSoftwareShader(bool bInRadial,
+                        const FVector2f& InStart,
+                        const FVector2f& InEnd,
+                        float InRadius,
+                        const rive::ColorInt InColors[],
+                        const float InStops[],
+                        size_t InCount);
+
+    /** Color at InLocalPosition, in the space the gradient was made in */
+    FVector4f Sample(const FVector2f& InLocalPosition) const;
+
+private:
+    bool bRadial;
+    FVector2f Start;
+    FVector2f Delta;
+    float InvLengthSquared;
+    float InvRadius;
+    FVector4f LUT[LUTSize];
+};
+
+class FRiveSoftwarePaint
+    : public rive::LITE_RTTI_OVERRIDE(rive::RenderPaint, FRiveSoftwarePaint)
+{
+public:
+    virtual void style(rive::RenderPaintStyle InStyle) override
+    {
+        Style = InStyle;
+    }
+    virtual void color(rive::ColorInt InColor) override { Color = InColor; }
+    virtual void thickness(float InThickness) override
+    {
+        Thickness = InThickness;
+    }
+    virtual void join(rive::StrokeJoin InJoin) override { Join = InJoin; }
+    virtual void cap(rive::StrokeCap InCap) override { Cap = InCap; }
+    virtual void blendMode(rive::BlendMode InBlendMode) override
+    {
+        BlendMode = InBlendMode;
+    }
+    virtual void shader(rive::rcp<rive::RenderShader> InShader) override
+    {
+        Shader = rive::lite_rtti_rcp_cast<FRiveSoftwareShader>(InShader);
+    }
+    virtual void invalidateStroke() override {}
+
+    rive::RenderPaintStyle Style = rive::RenderPaintStyle::fill;
+    rive::ColorInt Color = 0xff000000;
+    float Thickness = 1.f;
+    rive::StrokeJoin Join = rive::StrokeJoin::miter;
+    rive::StrokeCap Cap = rive::StrokeCap::butt;
+    rive::BlendMode BlendMode = rive::BlendMode::srcOver;
+    rive::rcp<FRiveSoftwareShader> Shader;
+};
+
+class FRiveSoftwareImage
+    : public rive::LITE_RTTI_OVERRIDE(rive::RenderImage, FRiveSoftwareImage)
+{
+public:
+    FRiveSoftwareImage(int32 InWidth,
+                       int32 InHeight,
+                       TArray<FVector4f> InPixels) :
+        Pixels(MoveTemp(InPixels))
+    {
+        m_Width = InWidth;
+        m_Height = InHeight;
+    }
+
+    /** Bilinear, clamped to the edges, InUV in pixels */
+    FVector4f Sample(const FVector2f& InUV) const;
+
+private:
+    /** Premultiplied */
+    TArray<FVector4f> Pixels;
+};
+
+class FRiveSoftwareBuffer
+    : public rive::LITE_RTTI_OVERRIDE(rive::RenderBuffer, FRiveSoftwareBuffer)
+{
+public:
+    FRiveSoftwareBuffer(rive::RenderBufferType InType,
+                        rive::RenderBufferFlags InFlags,
+                        size_t InSizeInBytes) :
+        lite_rtti_override(InType, InFlags, InSizeInBytes)
+    {
+        Data.SetNumZeroed(InSizeInBytes);
+    }
+
+    const uint8* GetData() const { return Data.GetData(); }
+
+protected:
+    virtual void* onMap() override { return Data.GetData(); }
+    virtual void onUnmap() override {}
+
+private:
+    TArray<uint8> Data;
+};
+
+#endif // WITH_RIVE
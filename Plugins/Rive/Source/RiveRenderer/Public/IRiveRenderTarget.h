@@ -48,6 +48,13 @@ public:
 
     virtual void Submit() = 0;
     virtual void SubmitAndClear() = 0;
+    /**
+     * Same as SubmitAndClear, unless bInContentChanged is false and the queued
+     * commands are the same as the last submitted ones. The commands are then
+     * dropped and the texture keeps its previous contents. Returns whether the
+     * commands were submitted.
+     */
+    virtual bool SubmitAndClearIfChanged(bool bInContentChanged) = 0;
     virtual void Save() = 0;
     virtual void Restore() = 0;
     virtual void Transform(float X1,
@@ -57,7 +64,12 @@ public:
                            float TX,
                            float TY) = 0;
     virtual void Translate(const FVector2f& InVector) = 0;
-    virtual void Draw(rive::Artboard* InArtboard) = 0;
+    /**
+     * InArtboardCS, if set, is held on the render thread while InArtboard is
+     * drawn, so it can not be advanced at the same time.
+     */
+    virtual void Draw(rive::Artboard* InArtboard,
+                      const TSharedPtr<FCriticalSection>& InArtboardCS) = 0;
     virtual void Align(const FBox2f& InBox,
                        ERiveFitType InFit,
                        const FVector2f& InAlignment,
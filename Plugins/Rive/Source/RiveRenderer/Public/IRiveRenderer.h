@@ -48,14 +48,63 @@ public:
     virtual UTextureRenderTarget2D* CreateDefaultRenderTarget(
         FIntPoint InTargetSize) = 0;
 
+    /**
+     * Guards the render context and its factory. Artboard and render target
+     * state have their own locks and should not take this one.
+     */
     virtual FCriticalSection& GetThreadDataCS() = 0;
 
     virtual void CallOrRegister_OnInitialized(
         FOnRendererInitialized::FDelegate&& Delegate) = 0;
 
+    /**
+     * Whether the render context's factory (image and font decoding) can be
+     * used from worker threads while GetThreadDataCS is held
+     */
+    virtual bool SupportsWorkerThreadDecode() const = 0;
+
+    /**
+     * Whether several worker threads can decode images through the factory
+     * at once, while one of them holds GetThreadDataCS
+     */
+    virtual bool SupportsParallelImageDecode() const = 0;
+
+    /**
+     * Whether MakeImageFromPixels uploads the pixels as they are, rather than
+     * going through an encode and decode round trip
+     */
+    virtual bool SupportsRawImagePixels() const = 0;
+
+    /** Whether MakeImageFromTexture can draw RHI textures directly */
+    virtual bool SupportsTextureImages() const = 0;
+
 #if WITH_RIVE
 
     virtual rive::gpu::RenderContext* GetRenderContext() = 0;
 
+    /**
+     * Factory files are imported and assets decoded with. The render context
+     * for GPU renderers, a no-op factory when running headless.
+     */
+    virtual rive::Factory* GetFactory() = 0;
+
+    /**
+     * Makes an image from raw 8 bit BGRA or RGBA pixels, without an encode and
+     * decode round trip where the renderer allows it. Call with
+     * GetThreadDataCS held.
+     */
+    virtual rive::rcp<rive::RenderImage> MakeImageFromPixels(
+        uint32 InWidth,
+        uint32 InHeight,
+        TArray<uint8> InPixels,
+        EPixelFormat InPixelFormat) = 0;
+
+    /**
+     * Makes an image sampling InTexture directly, or nullptr if the renderer
+     * can't draw RHI textures. Call with GetThreadDataCS held.
+     */
+    virtual rive::rcp<rive::RenderImage> MakeImageFromTexture(
+        const FTextureRHIRef& InTexture) = 0;
+
 #endif // WITH_RIVE
 };
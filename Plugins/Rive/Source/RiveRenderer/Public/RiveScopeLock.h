@@ -0,0 +1,41 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "HAL/CriticalSection.h"
+#include "RiveStats.h"
+#include "RiveTrace.h"
+
+/**
+ * Same as FScopeLock, but records in STAT_RiveLockContentions every time the
+ * lock was already held by another thread, and traces how long it waited.
+ */
+class FRiveScopeLock
+{
+public:
+    UE_NONCOPYABLE(FRiveScopeLock);
+
+    explicit FRiveScopeLock(FCriticalSection* InSynchObject) :
+        SynchObject(InSynchObject)
+    {
+        check(SynchObject);
+        if (!SynchObject->TryLock())
+        {
+            INC_DWORD_STAT(STAT_RiveLockContentions);
+#if RIVE_TRACE_ENABLED
+            RIVE_TRACE_SCOPE(RiveLockWait);
+            const double StartTime = FPlatformTime::Seconds();
+            SynchObject->Lock();
+            UE::Rive::Trace::CountLockWait(FPlatformTime::Seconds() -
+                                           StartTime);
+#else  // RIVE_TRACE_ENABLED
+            SynchObject->Lock();
+#endif // RIVE_TRACE_ENABLED
+        }
+    }
+
+    ~FRiveScopeLock() { SynchObject->Unlock(); }
+
+private:
+    FCriticalSection* SynchObject;
+};
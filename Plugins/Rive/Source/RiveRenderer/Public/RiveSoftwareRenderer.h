@@ -0,0 +1,165 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_RIVE
+
+THIRD_PARTY_INCLUDES_START
+#undef PI // redefined in rive/math/math_types.hpp
+#include "rive/factory.hpp"
+#include "rive/renderer.hpp"
+THIRD_PARTY_INCLUDES_END
+
+class FRiveSoftwareDrawList;
+
+/**
+ * Pixels the software renderer draws into, as premultiplied RGBA floats
+ * between 0 and 1, like the GPU render targets store them
+ */
+class RIVERENDERER_API FRiveSoftwareCanvas
+{
+public:
+    void Resize(int32 InWidth, int32 InHeight);
+
+    /** InColor is not premultiplied */
+    void Clear(const FLinearColor& InColor);
+
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+
+    FVector4f* GetRow(int32 InY) { return Pixels.GetData() + InY * Width; }
+
+    const FVector4f& GetPixel(int32 InX, int32 InY) const
+    {
+        return Pixels[InY * Width + InX];
+    }
+
+    /** Quantizes the pixels to 8 bit, still premultiplied */
+    void ReadPixels(TArray<FColor>& OutPixels) const;
+
+private:
+    int32 Width = 0;
+    int32 Height = 0;
+    TArray<FVector4f> Pixels;
+};
+
+/**
+ * rive::Factory whose paths, paints, gradients and images are plain CPU
+ * data for FRiveSoftwareRenderer
+ */
+class RIVERENDERER_API FRiveSoftwareFactory : public rive::Factory
+{
+public:
+    virtual rive::rcp<rive::RenderBuffer> makeRenderBuffer(
+        rive::RenderBufferType InType,
+        rive::RenderBufferFlags InFlags,
+        size_t InSizeInBytes) override;
+
+    virtual rive::rcp<rive::RenderShader> makeLinearGradient(
+        float InStartX,
+        float InStartY,
+        float InEndX,
+        float InEndY,
+        const rive::ColorInt InColors[],
+        const float InStops[],
+        size_t InCount) override;
+
+    virtual rive::rcp<rive::RenderShader> makeRadialGradient(
+        float InCenterX,
+        float InCenterY,
+        float InRadius,
+        const rive::ColorInt InColors[],
+        const float InStops[],
+        size_t InCount) override;
+
+    virtual rive::rcp<rive::RenderPath> makeRenderPath(
+        rive::RawPath& InRawPath,
+        rive::FillRule InFillRule) override;
+
+    virtual rive::rcp<rive::RenderPath> makeEmptyRenderPath() override;
+
+    virtual rive::rcp<rive::RenderPaint> makeRenderPaint() override;
+
+    /** PNG and JPEG go through the ImageWrapper module, others through rive */
+    virtual rive::rcp<rive::RenderImage> decodeImage(
+        rive::Span<const uint8_t> InEncodedBytes) override;
+
+    /** Makes an image from 8 bit BGRA or RGBA pixels, not premultiplied */
+    static rive::rcp<rive::RenderImage> MakeImage(
+        uint32 InWidth,
+        uint32 InHeight,
+        TConstArrayView<uint8> InPixels,
+        EPixelFormat InPixelFormat);
+};
+
+/**
+ * CPU implementation of rive::Renderer, drawing the paths, strokes,
+ * gradients, clips, images and blend modes of an artboard into a
+ * FRiveSoftwareCanvas. It is the reference image-diff tests compare
+ * against, and what renders rive textures when there is no GPU.
+ *
+ * Draw calls are only recorded. Flush rasterizes them in bands of rows on
+ * the task graph, each band drawing every recorded call in order.
+ * Only paths made by FRiveSoftwareFactory can be drawn.
+ */
+class RIVERENDERER_API FRiveSoftwareRenderer : public rive::Renderer
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    explicit FRiveSoftwareRenderer(FRiveSoftwareCanvas& InCanvas);
+
+    virtual ~FRiveSoftwareRenderer() override;
+
+    //~ BEGIN : rive::Renderer Interface
+
+public:
+    virtual void save() override;
+
+    virtual void restore() override;
+
+    virtual void transform(const rive::Mat2D& InTransform) override;
+
+    virtual void drawPath(rive::RenderPath* InPath,
+                          rive::RenderPaint* InPaint) override;
+
+    virtual void clipPath(rive::RenderPath* InPath) override;
+
+    virtual void drawImage(const rive::RenderImage* InImage,
+                           rive::BlendMode InBlendMode,
+                           float InOpacity) override;
+
+    virtual void drawImageMesh(const rive::RenderImage* InImage,
+                               rive::rcp<rive::RenderBuffer> InVertices,
+                               rive::rcp<rive::RenderBuffer> InUVCoords,
+                               rive::rcp<rive::RenderBuffer> InIndices,
+                               uint32_t InVertexCount,
+                               uint32_t InIndexCount,
+                               rive::BlendMode InBlendMode,
+                               float InOpacity) override;
+
+    //~ END : rive::Renderer Interface
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /** Rasterizes the draws recorded since the last flush into the canvas */
+    void Flush();
+
+    /**
+     * Attribute(s)
+     */
+
+private:
+    FRiveSoftwareCanvas& Canvas;
+
+    TUniquePtr<FRiveSoftwareDrawList> DrawList;
+};
+
+#endif // WITH_RIVE
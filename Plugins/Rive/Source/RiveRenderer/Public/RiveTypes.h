@@ -93,3 +93,15 @@ enum class ERiveInitState : uint8
     Initializing = 2,
     Initialized = 3,
 };
+
+/** How soon the assets a rive file loads on demand are decoded */
+UENUM(BlueprintType)
+enum class ERiveAssetLoadPriority : uint8
+{
+    /** Decoded on a background thread, after other background work */
+    Low = 0,
+    /** Decoded on a worker thread */
+    Normal = 1,
+    /** Decoded right away on the game thread, so the first frame has them */
+    High = 2,
+};
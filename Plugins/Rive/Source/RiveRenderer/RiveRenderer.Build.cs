@@ -31,7 +31,7 @@ public class RiveRenderer : ModuleRules
 		PublicDependencyModuleNames.AddRange(
 			new string[]
 			{
-				"Core", "RiveLibrary"
+				"Core", "RiveLibrary", "RiveStats"
 			}
 		);
 
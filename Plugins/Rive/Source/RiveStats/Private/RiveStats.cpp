@@ -1,3 +1,17 @@
 // Copyright Rive, Inc. All rights reserved.
 
 #include "RiveStats.h"
+
+DEFINE_STAT(STAT_RiveLockContentions);
+DEFINE_STAT(STAT_RiveSkippedIdleFrames);
+DEFINE_STAT(STAT_RiveBytesUploaded);
+DEFINE_STAT(STAT_RiveImageTextureMemory);
+DEFINE_STAT(STAT_RiveImageMipMemory);
+DEFINE_STAT(STAT_RiveAssetCacheHits);
+DEFINE_STAT(STAT_RiveAssetCacheMisses);
+DEFINE_STAT(STAT_RiveAssetCacheBytesSaved);
+DEFINE_STAT(STAT_RiveTexturePoolHits);
+DEFINE_STAT(STAT_RiveTexturePoolMisses);
+DEFINE_STAT(STAT_RiveTexturePoolMemory);
+DEFINE_STAT(STAT_RiveCookedImagesUsed);
+DEFINE_STAT(STAT_RiveFileDataReleased);
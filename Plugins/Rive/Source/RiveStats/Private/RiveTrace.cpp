@@ -0,0 +1,68 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveTrace.h"
+
+#if RIVE_TRACE_ENABLED
+
+#include "ProfilingDebugging/CountersTrace.h"
+
+#include <atomic>
+
+UE_TRACE_CHANNEL_DEFINE(RiveChannel);
+
+TRACE_DECLARE_INT_COUNTER(RiveDraws, TEXT("Rive/Flush/Draws"));
+TRACE_DECLARE_INT_COUNTER(RivePaths, TEXT("Rive/Flush/Paths"));
+TRACE_DECLARE_INT_COUNTER(RiveTessVertices, TEXT("Rive/Flush/TessVertices"));
+TRACE_DECLARE_INT_COUNTER(RiveGradientSpans,
+                          TEXT("Rive/Flush/GradientSpans"));
+TRACE_DECLARE_MEMORY_COUNTER(RiveBytesUploaded,
+                             TEXT("Rive/Flush/BytesUploaded"));
+TRACE_DECLARE_INT_COUNTER(RiveLogicalFlushes, TEXT("Rive/LogicalFlushes"));
+TRACE_DECLARE_FLOAT_COUNTER(RiveLockWait, TEXT("Rive/LockWait (ms)"));
+
+namespace UE::Private::RiveTrace
+{
+/** Bytes uploaded since the last logical flush was counted */
+std::atomic<uint64> PendingBytesUploaded{0};
+} // namespace UE::Private::RiveTrace
+
+namespace UE::Rive::Trace
+{
+void CountLogicalFlush(uint32 InDraws,
+                       uint32 InPaths,
+                       uint32 InTessVertices,
+                       uint32 InGradientSpans)
+{
+    using namespace UE::Private::RiveTrace;
+
+    const uint64 BytesUploaded = PendingBytesUploaded.exchange(0);
+    if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(RiveChannel))
+    {
+        return;
+    }
+
+    // Set rather than added, so each value lines up with the span of the
+    // render target that flushed
+    TRACE_COUNTER_SET(RiveDraws, InDraws);
+    TRACE_COUNTER_SET(RivePaths, InPaths);
+    TRACE_COUNTER_SET(RiveTessVertices, InTessVertices);
+    TRACE_COUNTER_SET(RiveGradientSpans, InGradientSpans);
+    TRACE_COUNTER_SET(RiveBytesUploaded, BytesUploaded);
+    TRACE_COUNTER_INCREMENT(RiveLogicalFlushes);
+}
+
+void CountBytesUploaded(uint64 InBytes)
+{
+    UE::Private::RiveTrace::PendingBytesUploaded += InBytes;
+}
+
+void CountLockWait(double InSeconds)
+{
+    if (UE_TRACE_CHANNELEXPR_IS_ENABLED(RiveChannel))
+    {
+        TRACE_COUNTER_SET(RiveLockWait, InSeconds * 1000.0);
+    }
+}
+} // namespace UE::Rive::Trace
+
+#endif // RIVE_TRACE_ENABLED
@@ -22,3 +22,88 @@ DECLARE_STATS_GROUP(TEXT("RiveRenderer"),
  * Stats group for all editor specific rive stats
  */
 DECLARE_STATS_GROUP(TEXT("RiveEditor"), STATGROUP_RiveEditor, STATCAT_Advanced);
+
+/*
+ * Number of times a rive lock (artboard, render target or render context) was
+ * already held by another thread when we tried to take it
+ */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Lock Contentions"),
+                                  STAT_RiveLockContentions,
+                                  STATGROUP_Rive,
+                                  RIVESTATS_API);
+
+/*
+ * Number of render target submissions skipped because nothing changed since
+ * the previous frame
+ */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Idle Frames"),
+                                  STAT_RiveSkippedIdleFrames,
+                                  STATGROUP_Rive,
+                                  RIVESTATS_API);
+
+/*
+ * Bytes copied from the rive renderer's CPU buffers to GPU buffers this frame
+ */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Uploaded"),
+                                  STAT_RiveBytesUploaded,
+                                  STATGROUP_RiveRenderer,
+                                  RIVESTATS_API);
+
+/*
+ * GPU memory used by the textures of decoded rive images, and the part of it
+ * taken by their mips (see r.rive.imagemips)
+ */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Image Texture Memory"),
+                           STAT_RiveImageTextureMemory,
+                           STATGROUP_RiveRenderer,
+                           RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Image Mip Memory"),
+                           STAT_RiveImageMipMemory,
+                           STATGROUP_RiveRenderer,
+                           RIVESTATS_API);
+
+/*
+ * Images and fonts of rive files that were found in the decoded asset cache,
+ * decoded because they were not, and the decoded memory the hits saved
+ */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Asset Cache Hits"),
+                                      STAT_RiveAssetCacheHits,
+                                      STATGROUP_Rive,
+                                      RIVESTATS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Asset Cache Misses"),
+                                      STAT_RiveAssetCacheMisses,
+                                      STATGROUP_Rive,
+                                      RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Asset Cache Bytes Saved"),
+                           STAT_RiveAssetCacheBytesSaved,
+                           STATGROUP_Rive,
+                           RIVESTATS_API);
+
+/*
+ * Render targets of rive textures reused from the texture pool, created
+ * because none matched, and the memory the pool holds
+ */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Texture Pool Hits"),
+                                      STAT_RiveTexturePoolHits,
+                                      STATGROUP_Rive,
+                                      RIVESTATS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Texture Pool Misses"),
+                                      STAT_RiveTexturePoolMisses,
+                                      STATGROUP_Rive,
+                                      RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Texture Pool Memory"),
+                           STAT_RiveTexturePoolMemory,
+                           STATGROUP_Rive,
+                           RIVESTATS_API);
+
+/* Images of cooked rive files uploaded from their cooked pixels */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cooked Images Used"),
+                                      STAT_RiveCookedImagesUsed,
+                                      STATGROUP_Rive,
+                                      RIVESTATS_API);
+
+/* Serialized .riv bytes released once their rive file was imported */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("File Data Released"),
+                           STAT_RiveFileDataReleased,
+                           STATGROUP_Rive,
+                           RIVESTATS_API);
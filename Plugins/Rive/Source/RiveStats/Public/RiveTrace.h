@@ -0,0 +1,62 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/*
+ * Unreal Insights channel of the rive plugin. Enable it with
+ * -trace=default,rive (or Trace.Enable rive) to see a span per artboard
+ * advanced or drawn, named "<File>/<Artboard>", and per render target, named
+ * after the texture or component, with the counters of each logical flush of
+ * the rive renderer and the time spent waiting on rive locks.
+ */
+#if !defined(RIVE_TRACE_ENABLED)
+#define RIVE_TRACE_ENABLED (CPUPROFILERTRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+#if RIVE_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(RiveChannel, RIVESTATS_API);
+
+/* Span named after the identifier Name */
+#define RIVE_TRACE_SCOPE(Name)                                                 \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, RiveChannel)
+
+/*
+ * Span named by the FString expression InName, which is only evaluated while
+ * RiveChannel is traced
+ */
+#define RIVE_TRACE_SCOPE_TEXT(InName)                                          \
+    TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(                             \
+        UE_TRACE_CHANNELEXPR_IS_ENABLED(RiveChannel) ? *FString(InName)        \
+                                                     : TEXT(""),               \
+        RiveChannel)
+
+namespace UE::Rive::Trace
+{
+/**
+ * Sets the counters of a logical flush of the rive renderer: its draw
+ * batches, paths, tessellated vertices, gradient spans, and the bytes
+ * uploaded since the previous flush.
+ */
+RIVESTATS_API void CountLogicalFlush(uint32 InDraws,
+                                     uint32 InPaths,
+                                     uint32 InTessVertices,
+                                     uint32 InGradientSpans);
+
+/** Adds to the bytes the next logical flush reports as uploaded */
+RIVESTATS_API void CountBytesUploaded(uint64 InBytes);
+
+/** Reports InSeconds spent blocked on a contended rive lock */
+RIVESTATS_API void CountLockWait(double InSeconds);
+} // namespace UE::Rive::Trace
+
+#else // RIVE_TRACE_ENABLED
+
+#define RIVE_TRACE_SCOPE(Name)
+#define RIVE_TRACE_SCOPE_TEXT(InName)
+
+#endif // RIVE_TRACE_ENABLED